@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 
+#include <stddef.h>
 #include "cy_device_headers.h"
 #include "cy_syslib.h"
 #include "cy_sysclk.h"
@@ -39,22 +40,128 @@ static void Cy_CSDADC_SetAdcChannel(
                 uint32_t chId,
                 uint32_t state,
                 const cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_SwitchAdcChannel(
+                uint32_t chId,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_SetVddaSwitch(
+                uint32_t state,
+                const cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_PrepareMeasurement(
+                cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_CalcVdda(
+                uint32_t timeVssa2Vref,
+                uint32_t timeRecover,
+                uint32_t timeVdda2Vref,
+                const cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_SetCalibration(
+                uint32_t timeVssa2Vref,
+                uint32_t timeRecover,
+                uint32_t timeVdda2Vref,
+                cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_CalibrateIdac(
+                uint32_t timeVssa2Vref,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_ResumeConversion(
+                cy_stc_csdadc_context_t * context);
 static void Cy_CSDADC_DsInitialize(
                 const cy_stc_csdadc_config_t * config,
                 cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_IsCalibrationKept(
+                const cy_stc_csdadc_config_t * config,
+                const cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_UpdateConfig(
+                const cy_stc_csdadc_config_t * config,
+                cy_stc_csdadc_context_t * context);
 static void Cy_CSDADC_Configure(
                 const cy_stc_csdadc_context_t * context);
 static void Cy_CSDADC_SetClkDivider(
                 const cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_SetCsdConfig(
+                cy_stc_csd_config_t * csdCfg,
+                const cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_IsDriftInRange(
+                uint32_t adcResult,
+                uint32_t calibrTime,
+                const cy_stc_csdadc_context_t * context);
+static cy_en_csdadc_status_t Cy_CSDADC_CheckCalibration(
+                cy_stc_csdadc_context_t * context);
+static cy_en_csdadc_status_t Cy_CSDADC_CalibrateBlocking(
+                cy_stc_csdadc_context_t * context);
 static void Cy_CSDADC_StartFSM(
                 uint32_t measureMode,
+                cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_GetTimestamp(
                 const cy_stc_csdadc_context_t * context);
+static uint16_t Cy_CSDADC_CalcCrc(
+                const uint8_t * ptrData,
+                uint32_t size);
+#if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+static void Cy_CSDADC_UpdatePhaseStat(
+                uint32_t phase,
+                uint32_t duration,
+                cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_GetConversionPhase(
+                uint32_t fsmStatus);
+#endif
 static uint8_t Cy_CSDADC_GetNextCh(
                 uint8_t currChId,
                 const cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_ScheduleCycle(
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_CheckLimit(
+                uint32_t chId,
+                uint32_t code,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_UpdateStat(
+                uint32_t chId,
+                uint32_t code,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_ClearStat(
+                cy_stc_csdadc_ch_stat_t * stat);
+static void Cy_CSDADC_FlipFrame(
+                cy_stc_csdadc_context_t * context);
 static uint32_t Cy_CSDADC_StartAndWait(
                 uint32_t measureMode,
                 const cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_SetDivisor(
+                uint32_t divisor,
+                cy_stc_csdadc_divisor_t * ptrDivisor);
+static uint32_t Cy_CSDADC_Divide(
+                uint32_t dividend,
+                const cy_stc_csdadc_divisor_t * ptrDivisor);
+static void Cy_CSDADC_StreamPush(
+                uint32_t chId,
+                uint32_t code,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_StoreResult(
+                uint32_t chId,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_RawPush(
+                uint32_t chId,
+                uint32_t adcRes,
+                cy_stc_csdadc_context_t * context);
+static void Cy_CSDADC_UpdateDivisors(
+                cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_GetChRange(
+                uint32_t chId,
+                const cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_GetTime(
+                uint32_t adcValue,
+                uint32_t polarity,
+                uint32_t range,
+                const cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_ScaleResult(
+                uint32_t time,
+                uint32_t range,
+                const cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_CodeToMv(
+                uint32_t code,
+                uint32_t range,
+                const cy_stc_csdadc_context_t * context);
+static uint32_t Cy_CSDADC_ResultToMv(
+                uint32_t adcValue,
+                uint32_t polarity,
+                const cy_stc_csdadc_context_t * context);
 
 /** \}
 * \endcond */
@@ -84,6 +191,20 @@ static uint32_t Cy_CSDADC_StartAndWait(
 #define CY_CSDADC_RES_10_PLUS_1_MAX_VAL             (2047u)
 
 #define CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM           (0x0000FFFFu)
+/* The frame index for no result frame indication */
+#define CY_CSDADC_NO_FRAME                          (0xFFu)
+/* The initial min value of the channel statistics */
+#define CY_CSDADC_STAT_MIN_INIT                     (0xFFFFu)
+/* The initial min value of the phase statistics */
+#define CY_CSDADC_PHASE_MIN_INIT                    (0xFFFFFFFFu)
+/* The saturation value of the request deferral counter */
+#define CY_CSDADC_MAX_WAIT_CNT                      (0xFFFFu)
+/* The CRC-16-CCITT polynomial and seed of the calibration data */
+#define CY_CSDADC_CRC_POLYNOMIAL                    (0x1021u)
+#define CY_CSDADC_CRC_SEED                          (0xFFFFu)
+#define CY_CSDADC_CRC_MSB_MASK                      (0x8000u)
+/* The calibrTolerance parameter is in 0.1% units */
+#define CY_CSDADC_CALIBR_TOLERANCE_SCALE            (1000u)
 
 #define CY_CSDADC_CHAN_DISCONNECT                   (0u)
 #define CY_CSDADC_CHAN_CONNECT                      (1u)
@@ -94,12 +215,13 @@ static uint32_t Cy_CSDADC_StartAndWait(
 /* IdacB Leg3 LSB current in pA */
 #define CY_CSDADC_IDAC_LSB                          (37500u)
 #define CY_CSDADC_IDAC_MAX                          (127u)
+#define CY_CSDADC_IDAC_MIN                          (1u)
+/* The calibrated time of phase 1 is accepted within a factor of 2 of the target */
+#define CY_CSDADC_IDAC_TARGET_SHIFT                 (1u)
+/* The max number of phase 1 measurements of the calibration with the IDAC search */
+#define CY_CSDADC_IDAC_CALIBR_STEPS                 (9u)
 #define CY_CSDADC_IDACB_CONFIG                      (0x04000080u)
 
-#define CY_CSDADC_MIN_SNSCLK_DIVIDER                (4u)
-#define CY_CSDADC_MAX_SNSCLK_DIVIDER                (0xFFFu)
-#define CY_CSDADC_MAX_SNSCLK_CYCLES                 (0xFFu)
-
 /* Default filter delay */
 #define CY_CSDADC_FILTER_DELAY_DEFAULT              (2u)
 #define CY_CSDADC_CSD_REG_CONFIG_FILTER_DELAY_Pos   (4u)
@@ -228,6 +350,14 @@ static uint32_t Cy_CSDADC_StartAndWait(
 #define CY_CSDADC_STATUS_CALIBPH2                   (0x20u)
 #define CY_CSDADC_STATUS_CALIBPH3                   (0x30u)
 #define CY_CSDADC_STATUS_CONVERTING                 (0x40u)
+#define CY_CSDADC_STATUS_VDDAPH1                    (0x50u)
+#define CY_CSDADC_STATUS_VDDAPH2                    (0x60u)
+#define CY_CSDADC_STATUS_VDDAPH3                    (0x70u)
+#define CY_CSDADC_STATUS_AMUXB                      (0x80u)
+#define CY_CSDADC_STATUS_BGCALPH1                   (0x90u)
+#define CY_CSDADC_STATUS_BGCALPH2                   (0xA0u)
+#define CY_CSDADC_STATUS_BGCALPH3                   (0xB0u)
+#define CY_CSDADC_STATUS_FSM_STEP                   (0x10u)
 
 #define CY_CSDADC_FSM_ABORT                         (0x08u)
 #define CY_CSDADC_FSM_AZ0_SKIP                      (0x100u)
@@ -235,6 +365,30 @@ static uint32_t Cy_CSDADC_StartAndWait(
 #define CY_CSDADC_FSM_AZ_SKIP_DEFAULT               (CY_CSDADC_FSM_AZ0_SKIP)
 #define CY_CSDADC_FSM_START                         (0x00000001uL)
 
+/* Count trailing zeros is done by the RBIT and CLZ instructions if the core supports them */
+#if ((defined(__ARM_ARCH_7M__) && (__ARM_ARCH_7M__ == 1)) || \
+     (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1)) || \
+     (defined(__ARM_ARCH_8M_MAIN__) && (__ARM_ARCH_8M_MAIN__ == 1)) || \
+     (defined(__ARM_ARCH_8_1M_MAIN__) && (__ARM_ARCH_8_1M_MAIN__ == 1)))
+    #define CY_CSDADC_CTZ_HW_EN                     (1u)
+#else
+    #define CY_CSDADC_CTZ_HW_EN                     (0u)
+    /* De Bruijn sequence for count trailing zeros */
+    #define CY_CSDADC_CTZ_DEBRUIJN                  (0x077CB531uL)
+    #define CY_CSDADC_CTZ_DEBRUIJN_SHIFT            (27u)
+#endif
+
+/* Mask of all channels for the given number of channels, valid up to CY_CSDADC_MAX_CHAN_NUM */
+#define CY_CSDADC_CH_MASK_ALL(numCh)                ((CY_CSDADC_MAX_CHAN_NUM <= (uint32_t)(numCh)) ? 0xFFFFFFFFuL : \
+                                                        ((uint32_t)(1uL << (uint32_t)(numCh)) - 1u))
+
+/* Number of conversions per channel result for the given oversampling */
+#define CY_CSDADC_OVERSAMPLING_NUM(os)              (1uL << (2u * (uint32_t)(os)))
+
+/* Fixed-point reciprocal definitions */
+#define CY_CSDADC_DIVISOR_FRACT_BITS                (32u)
+#define CY_CSDADC_DIVISOR_MAX_SHIFT                 (31u)
+
 /*******************************************************************************
 * Function Name: Cy_CSDADC_Init
 ****************************************************************************//**
@@ -265,7 +419,8 @@ static uint32_t Cy_CSDADC_StartAndWait(
 *                           function. The CSDADC cannot be initialized
 *                           right now. The user waits until
 *                           the CSD HW block passes to the idle state.
-* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL or the oversampling
+*                           is out of range.
 *                           The function was not performed.
 *
 * \funcusage
@@ -312,12 +467,15 @@ cy_en_csdadc_status_t Cy_CSDADC_Init(
     CY_ASSERT_L1(NULL != config);
     CY_ASSERT_L1(NULL != context);
 
-    if ((NULL != config) && (NULL != context))
+    if ((NULL != config) && (NULL != context) &&
+        (CY_CSDADC_OVERSAMPLING_64X >= config->oversampling))
     {
         /* Copy the configuration structure to the context */
         context->cfgCopy = *config;
         /* Disconnect all CSDADC channels */
         Cy_CSDADC_ClearChannels(context);
+        /* Clear the timestamp function, the context may be not initialized yet */
+        context->ptrTimestamp = NULL;
         /* Capture the CSD HW block for the ADC functionality */
         result = Cy_CSDADC_Restore(context);
         if (CY_CSDADC_SUCCESS == result)
@@ -406,13 +564,22 @@ cy_en_csdadc_status_t Cy_CSDADC_Init(
 cy_en_csdadc_status_t Cy_CSDADC_Enable(cy_stc_csdadc_context_t * context)
 {
     cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        uint32_t startTime;
+    #endif
 
     CY_ASSERT_L1(NULL != context);
 
     if (NULL != context)
     {
+        #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+            startTime = Cy_CSDADC_GetTimestamp(context);
+        #endif
         /* Configure HW block */
         Cy_CSDADC_Configure(context);
+        #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+            Cy_CSDADC_UpdatePhaseStat(CY_CSDADC_PHASE_CONFIGURE, Cy_CSDADC_GetTimestamp(context) - startTime, context);
+        #endif
 
         /* Calibrate CSDADC */
         result = Cy_CSDADC_Calibrate(context);
@@ -421,6 +588,75 @@ cy_en_csdadc_status_t Cy_CSDADC_Enable(cy_stc_csdadc_context_t * context)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_CSDADC_EnableWarm
+****************************************************************************//**
+*
+* Initializes the CSDADC firmware modules with the stored calibration data.
+*
+* This function is an alternative to the Cy_CSDADC_Enable() function for
+* the fast start-up. Instead of the blocking calibration, the function
+* imports the calibration data previously exported by
+* the Cy_CSDADC_ExportCalibration() function, so the conversion can be
+* started immediately. The imported data is refreshed in the background
+* after the first enabled channel cycle of the next Continuous mode
+* conversion regardless of the calibrInterval field of
+* the \ref cy_stc_csdadc_config_t structure. In Single-shot mode, call
+* the Cy_CSDADC_Calibrate() function when the time allows.
+*
+* If the calibration data is not accepted by the Cy_CSDADC_ImportCalibration()
+* function, e.g. the data is corrupted or was obtained with another
+* configuration, the function performs the regular Cy_CSDADC_Enable().
+*
+* \param calibrData
+* The pointer to the stored calibration data.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* Returns the status of the initialization process. If CY_RET_SUCCESS is not
+* received, some of the initialization fails.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_EnableWarm(
+                const cy_stc_csdadc_calibr_data_t * calibrData,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        uint32_t startTime;
+    #endif
+
+    CY_ASSERT_L1(NULL != calibrData);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != calibrData) && (NULL != context))
+    {
+        if (CY_CSDADC_SUCCESS == Cy_CSDADC_ImportCalibration(calibrData, context))
+        {
+            #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+                startTime = Cy_CSDADC_GetTimestamp(context);
+            #endif
+            /* Configure HW block */
+            Cy_CSDADC_Configure(context);
+            #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+                Cy_CSDADC_UpdatePhaseStat(CY_CSDADC_PHASE_CONFIGURE, Cy_CSDADC_GetTimestamp(context) - startTime, context);
+            #endif
+
+            /* Refresh the imported calibration data in the background */
+            context->calibrPending = 1u;
+            result = CY_CSDADC_SUCCESS;
+        }
+        else
+        {
+            result = Cy_CSDADC_Enable(context);
+        }
+    }
+    return result;
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_CSDADC_DeInit
 ****************************************************************************//**
@@ -516,6 +752,14 @@ cy_en_csdadc_status_t Cy_CSDADC_DeInit(cy_stc_csdadc_context_t * context)
 *   a conversion, the user should call the Cy_CSDADC_StartConvert() function.
 * * Returns a status code regarding the function execution result
 *
+* If the middleware is calibrated and the new configuration differs only in
+* the parameters that do not affect the calibration (the channel list,
+* the acquisition, auto-zero and CSD initialization times, the oversampling,
+* the CPU clock, the background calibration interval and tolerance), the
+* function keeps the calibration data and only updates the channels and
+* the timing registers. Otherwise, the CSDADC is reconfigured and
+* recalibrated.
+*
 * \warning
 * Call this function only in the CSD HW block idle state.
 * Calling this function during a conversion will yield unpredictable
@@ -536,7 +780,8 @@ cy_en_csdadc_status_t Cy_CSDADC_DeInit(cy_stc_csdadc_context_t * context)
 * \return
 * The function returns the status of its operation.
 * * CY_CSDADC_SUCCESS          - The function performed successfully.
-* * CY_CSDADC_BAD_PARAM        - A context pointer or config pointer is equal to NULL.
+* * CY_CSDADC_BAD_PARAM        - A context pointer or config pointer is equal to NULL
+*                                or the oversampling is out of range.
 *                                The function was not performed.
 * * CY_CSDADC_HW_BUSY          - A conversion is not started. The previously
 *                                initiated conversion is in progress or
@@ -555,26 +800,158 @@ cy_en_csdadc_status_t Cy_CSDADC_WriteConfig(
     CY_ASSERT_L1(NULL != config);
     CY_ASSERT_L1(NULL != context);
 
-    if ((NULL == config) || (NULL ==context))
+    if ((NULL == config) || (NULL ==context) ||
+        (CY_CSDADC_OVERSAMPLING_64X < config->oversampling))
     {
         result = CY_CSDADC_BAD_PARAM;
     }
     else
     {
-        /* Copy the configuration structure to the context */
-        context->cfgCopy = * config;
-        /* Disconnect all CSDADC channels */
-        Cy_CSDADC_ClearChannels(context);
-        /* Initialize CSDADC data structure */
-        Cy_CSDADC_DsInitialize(config, context);
-        /* Configure and calibrate CSDADC */
-        result = Cy_CSDADC_Enable(context);
+        if (0u != Cy_CSDADC_IsCalibrationKept(config, context))
+        {
+            /* Update the channels and the timing only */
+            Cy_CSDADC_UpdateConfig(config, context);
+        }
+        else
+        {
+            /* Disconnect the channels of the previous configuration */
+            if ((uint16_t)CY_CSDADC_INIT_DONE == (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
+            {
+                Cy_CSDADC_ClearChannels(context);
+            }
+            /* Copy the configuration structure to the context */
+            context->cfgCopy = * config;
+            /* Disconnect all CSDADC channels */
+            Cy_CSDADC_ClearChannels(context);
+            /* Initialize CSDADC data structure */
+            Cy_CSDADC_DsInitialize(config, context);
+            /* Configure and calibrate CSDADC */
+            result = Cy_CSDADC_Enable(context);
+        }
     }
 
     return (result);
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_CSDADC_IsCalibrationKept
+****************************************************************************//**
+*
+* Checks whether the current calibration data is valid for the new
+* configuration.
+*
+* The calibration data depends on the CSD HW block, the clocks, the reference
+* voltage, the analog supply, the range, and the resolution.
+*
+* \param config
+* The pointer to the new CSDADC configuration structure.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* Returns 1 if the middleware is calibrated and the new configuration keeps
+* the calibration data valid, otherwise 0.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_IsCalibrationKept(
+                const cy_stc_csdadc_config_t * config,
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t retVal = 0u;
+    const cy_stc_csdadc_config_t * ptrCfgCopy = &context->cfgCopy;
+
+    if (((uint16_t)CY_CSDADC_INIT_DONE == (context->status & (uint16_t)CY_CSDADC_INIT_MASK)) &&
+        (0u != context->calibrDone) &&
+        (config->base == ptrCfgCopy->base) &&
+        (config->csdCxtPtr == ptrCfgCopy->csdCxtPtr) &&
+        (config->periClk == ptrCfgCopy->periClk) &&
+        (config->vref == ptrCfgCopy->vref) &&
+        (config->vdda == ptrCfgCopy->vdda) &&
+        (config->range == ptrCfgCopy->range) &&
+        (config->resolution == ptrCfgCopy->resolution) &&
+        (config->periDivTyp == ptrCfgCopy->periDivTyp) &&
+        (config->periDivInd == ptrCfgCopy->periDivInd) &&
+        (config->operClkDivider == ptrCfgCopy->operClkDivider) &&
+        (config->idacCalibrationEn == ptrCfgCopy->idacCalibrationEn) &&
+        ((0u == config->chRangeVref) == (0u == ptrCfgCopy->chRangeVref)))
+    {
+        retVal = 1u;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_UpdateConfig
+****************************************************************************//**
+*
+* Applies the new configuration that keeps the calibration data valid.
+*
+* Re-initializes the context, restores the calibration data, reconnects
+* the channels if the channel list changes, and updates the sense clock
+* period and the auto-zero time of the CSD HW block. The acquisition time
+* is applied with the next conversion start.
+*
+* \param config
+* The pointer to the new CSDADC configuration structure.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_UpdateConfig(
+                const cy_stc_csdadc_config_t * config,
+                cy_stc_csdadc_context_t * context)
+{
+    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
+    uint32_t chChanged = 0u;
+    uint16_t tFull = context->tFull;
+    uint16_t tVssa2Vref = context->tVssa2Vref;
+    uint16_t tRecover = context->tRecover;
+    uint16_t tVdda2Vref = context->tVdda2Vref;
+    uint16_t tVdda2VrefRaw = context->tVdda2VrefRaw;
+    uint16_t vMaxMv = context->vMaxMv;
+    uint8_t idac = context->cfgCopy.idac;
+    uint8_t calibrPending = context->calibrPending;
+
+    if ((config->ptrPinList != context->cfgCopy.ptrPinList) ||
+        (config->numChannels != context->cfgCopy.numChannels))
+    {
+        /* Disconnect the channels of the previous configuration */
+        Cy_CSDADC_ClearChannels(context);
+        chChanged = 1u;
+    }
+
+    context->cfgCopy = * config;
+    if (0u != chChanged)
+    {
+        /* Set the new channels to the disconnected state */
+        Cy_CSDADC_ClearChannels(context);
+    }
+    Cy_CSDADC_DsInitialize(config, context);
+
+    /* Restore the calibration data */
+    context->tFull = tFull;
+    context->tVssa2Vref = tVssa2Vref;
+    context->tRecover = tRecover;
+    context->tVdda2Vref = tVdda2Vref;
+    context->tVdda2VrefRaw = tVdda2VrefRaw;
+    context->vMaxMv = vMaxMv;
+    context->cfgCopy.idac = idac;
+    context->calibrDone = 1u;
+    /* The imported calibration data is still to be refreshed */
+    context->calibrPending = calibrPending;
+    Cy_CSDADC_UpdateDivisors(context);
+
+    /* Update the timing registers */
+    ptrCsdBaseAdd->SENSE_PERIOD = (uint32_t)context->snsClkDivider - 1u;
+    ptrCsdBaseAdd->SEQ_TIME = (uint32_t)context->azCycles - 1u;
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_CSDADC_RegisterCallback
 ****************************************************************************//**
@@ -647,15 +1024,156 @@ cy_en_csdadc_status_t Cy_CSDADC_UnRegisterCallback(
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_CSDADC_RegisterTimestamp
+****************************************************************************//**
+*
+* Registers a timestamp function that is used by the extended results,
+* refer to Cy_CSDADC_ResultExtEnable(), and by the phase duration
+* statistics, refer to Cy_CSDADC_GetPhaseStat().
+*
+* The function is called from the CSDADC interrupt handler, so it should be
+* short, e.g. read DWT->CYCCNT on the CM4 core. The returned counter must
+* be a free-running 32-bit up-counter, refer to \ref cy_csdadc_timestamp_t.
+* The timestamp function is unregistered by
+* the Cy_CSDADC_Init() and Cy_CSDADC_WriteConfig() functions.
+*
+* \param timestampFunction
+* The pointer to the timestamp function. NULL - unregisters the function.
+*
+* \param context
+* The pointer to the CSDADC context structure \ref cy_stc_csdadc_context_t.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS      - The processing performed successfully.
+* * CY_CSDADC_BAD_PARAM    - The input parameter is invalid.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_RegisterTimestamp(
+                cy_csdadc_timestamp_t timestampFunction,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t retVal = CY_CSDADC_SUCCESS;
+
+    if(NULL != context)
+    {
+        context->ptrTimestamp = timestampFunction;
+    }
+    else
+    {
+        retVal = CY_CSDADC_BAD_PARAM;
+    }
+
+    return(retVal);
+}
+
+
+#if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetPhaseStat
+****************************************************************************//**
+*
+* Reads the duration statistics of the specified CSDADC operation phase.
+*
+* The statistics are collected only if CY_CSDADC_INSTRUMENTATION_EN is
+* enabled and the timestamp function is registered by
+* Cy_CSDADC_RegisterTimestamp(). The durations are in the timestamp units.
+* The conversion phases are measured from the conversion start to
+* the CSDADC interrupt, so they include the interrupt latency.
+*
+* \param phase
+* The phase to read.
+*
+* \param stat
+* The pointer to the structure to store the phase statistics.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS      - The statistics are read.
+* * CY_CSDADC_BAD_PARAM    - The input parameter is invalid.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_GetPhaseStat(
+                cy_en_csdadc_phase_t phase,
+                cy_stc_csdadc_phase_stat_t * stat,
+                const cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t retVal = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != stat);
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L3(CY_CSDADC_PHASE_NUM > (uint32_t)phase);
+
+    if ((NULL != stat) && (NULL != context) && (CY_CSDADC_PHASE_NUM > (uint32_t)phase))
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        *stat = context->phaseStat[phase];
+        Cy_SysLib_ExitCriticalSection(interruptState);
+        retVal = CY_CSDADC_SUCCESS;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ResetPhaseStat
+****************************************************************************//**
+*
+* Resets the duration statistics of all CSDADC operation phases.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS      - The statistics are reset.
+* * CY_CSDADC_BAD_PARAM    - The input parameter is invalid.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_ResetPhaseStat(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t retVal = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
+    uint32_t phase;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        for (phase = 0u; phase < CY_CSDADC_PHASE_NUM; phase++)
+        {
+            context->phaseStat[phase].sum = 0u;
+            context->phaseStat[phase].min = CY_CSDADC_PHASE_MIN_INIT;
+            context->phaseStat[phase].max = 0u;
+            context->phaseStat[phase].count = 0u;
+        }
+        Cy_SysLib_ExitCriticalSection(interruptState);
+        retVal = CY_CSDADC_SUCCESS;
+    }
+
+    return (retVal);
+}
+#endif /* (0u != CY_CSDADC_INSTRUMENTATION_EN) */
+
+
 /*******************************************************************************
 * Function Name: Cy_CSDADC_Configure
 ****************************************************************************//**
 *
 * Configures the CSD HW block to be used as an ADC.
 *
-* Configures the IDACB, internal switches, REFGEN, and HSCOMP. This
-* function is used by the Cy_CSDADC_Restore() API to set the CSD HW block
-* in the same state as before the Cy_CSDADC_Save() API was called.
+* Configures the IDACB, internal switches, REFGEN, and HSCOMP. The same
+* register values are used by the Cy_CSDADC_Restore() API to set the CSD HW
+* block in the same state as before the Cy_CSDADC_Save() API was called,
+* refer to Cy_CSDADC_SetCsdConfig().
 *
 * \param context
 * The pointer to the CSDADC context structure.
@@ -942,7 +1460,8 @@ cy_en_csdadc_status_t Cy_CSDADC_Save(cy_stc_csdadc_context_t * context)
 * The function neither initiates a conversion nor converts the ADC result
 * in millivolts. Instead, it returns the most recent conversion result
 * on specified input as an ADC code. The valid range for result is
-* from 0 to 2^ CSDADCresolution - 1.
+* from 0 to 2^ CSDADCresolution - 1. In the oversampling mode, the range is
+* multiplied by 2^oversampling, refer to \ref cy_en_csdadc_oversampling_t.
 *
 * \param chId
 * An ID of the input channel to read the most recent result. Acceptable values
@@ -952,7 +1471,8 @@ cy_en_csdadc_status_t Cy_CSDADC_Save(cy_stc_csdadc_context_t * context)
 * The pointer to the CSDADC context structure.
 *
 * \return
-* Specifies the CSDADC input channel code result between 0 and 2^resolution - 1.
+* Specifies the CSDADC input channel code result between 0 and 2^resolution - 1
+* (multiplied by 2^oversampling in the oversampling mode).
 * If a channel number is invalid, CY_CSDADC_MEASUREMENT_FAILED is returned
 * because this function returns a number (not a status).
 *
@@ -1012,1207 +1532,4382 @@ uint32_t Cy_CSDADC_GetResultVoltage(
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_Restore
+* Function Name: Cy_CSDADC_SetChannelRate
 ****************************************************************************//**
 *
-* Resumes the middleware operation if the Cy_CSDADC_Save() function was
-* called previously.
+* Sets the conversion rate divider of the specified channel.
 *
-* This function, along with the Cy_CSDADC_Save() function, is specifically
-* designed for ease of use and supports time multiplexing of the CSD HW block
-* among multiple middleware. When the CSD HW block is shared by two or more
-* middleware, this function can be used to restore the previous state of
-* the CSD HW block and CSDADC middleware saved using the
-* Cy_CSDACD_Save() function.
-* This function performs a sub-set of initialization tasks and is used into the
-* Cy_CSDADC_Init() function.
+* In Continuous mode, the channel enabled in the chMask parameter of
+* the Cy_CSDADC_StartConvert() function is converted once per rateDiv
+* enabled channel cycles, starting from the first cycle. This allows
+* spending the conversion time on the fast signals instead of oversampling
+* the slow ones. The cycles where no channel is scheduled are skipped
+* but counted by the cycle number, refer to Cy_CSDADC_GetConversionStatus().
+* In Single-shot mode, all channels enabled in chMask are converted once
+* regardless of the rate dividers.
 *
-* \param context
-* The pointer to the CSDADC middleware context structure.
+* The function can be called at any time. If a conversion is in progress,
+* the new divider applies starting from the next cycle. The rate dividers
+* are set to 1 by the Cy_CSDADC_Init() and Cy_CSDADC_WriteConfig() functions.
 *
-* \return
-* Returns the status of the resume process. If CY_CSDADC_SUCCESS is not
-* received, the resume process fails and a retry may be required.
+* \param chId
+* The ID of the channel.
 *
-* \funcusage
+* \param rateDiv
+* The rate divider from 1 (every cycle) to \ref CY_CSDADC_RATE_DIV_MAX.
 *
-* An example of sharing the CSD HW block by CAPSENSE&trade; and CSDADC middleware:
-* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_TimeMultiplex
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The rate divider is set.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL, the channel ID
+*                           or the rate divider is invalid.
 *
 *******************************************************************************/
-cy_en_csdadc_status_t Cy_CSDADC_Restore(cy_stc_csdadc_context_t * context)
+cy_en_csdadc_status_t Cy_CSDADC_SetChannelRate(
+                uint32_t chId,
+                uint32_t rateDiv,
+                cy_stc_csdadc_context_t * context)
 {
     cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
 
-    uint32_t watchdogCounter;
-    cy_en_csd_key_t mvKey;
-    cy_en_csd_status_t initStatus = CY_CSD_LOCKED;
-    const cy_stc_csd_config_t csdCfg = CY_CSDADC_CSD_CONFIG_DEFAULT;
-    CSD_Type * ptrCsdBaseAdd;
-    cy_stc_csd_context_t * ptrCsdCxt;
-
-    /* Number of cycle of one for() loop */
-    const uint32_t cyclesPerLoop = 5u;
-    /* Timeout in microseconds */
-    const uint32_t watchdogTimeoutUs = 10000u;
+    CY_ASSERT_L1(NULL != context);
 
-    if (NULL != context)
+    if ((NULL != context) && (chId < context->cfgCopy.numChannels) &&
+        (0u != rateDiv) && (CY_CSDADC_RATE_DIV_MAX >= rateDiv))
     {
-        ptrCsdBaseAdd = context->cfgCopy.base;
-        ptrCsdCxt = context->cfgCopy.csdCxtPtr;
-
-        result = CY_CSDADC_HW_LOCKED;
-
-        /* Get the CSD HW block status */
-        mvKey = Cy_CSD_GetLockStatus(ptrCsdBaseAdd, ptrCsdCxt);
-        if(CY_CSD_NONE_KEY == mvKey)
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        context->chRateDiv[chId] = (uint8_t)rateDiv;
+        if (1u < rateDiv)
         {
-            ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
-            ptrCsdBaseAdd->SEQ_START = CY_CSDADC_FSM_ABORT;
-
-            /* Initialize Watchdog Counter to prevent a hang */
-            watchdogCounter = (watchdogTimeoutUs * (context->cfgCopy.cpuClk / CY_CSDADC_MEGA)) / cyclesPerLoop;
-            do
-            {
-                initStatus = Cy_CSD_GetConversionStatus(ptrCsdBaseAdd, ptrCsdCxt);
-                watchdogCounter--;
-            }
-            while((CY_CSD_BUSY == initStatus) && (0u != watchdogCounter));
-
-            /* Clear all interrupt pending requests */
-            ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
-            (void)ptrCsdBaseAdd->INTR;
-
-            /* Set idle status */
-            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
-            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
-
-            /* Capture the CSD HW block for the ADC functionality */
-            initStatus = Cy_CSD_Init(ptrCsdBaseAdd, &csdCfg, CY_CSD_ADC_KEY, ptrCsdCxt);
-
-            if (CY_CSD_SUCCESS == initStatus)
-            {
-                /* Configure the CSD HW block */
-                Cy_CSDADC_Configure(context);
-                result = CY_CSDADC_SUCCESS;
-            }
+            context->rateMask |= (uint32_t)(1uL << chId);
+        }
+        else
+        {
+            context->rateMask &= (uint32_t)~(uint32_t)(1uL << chId);
+        }
+        /* Do not wait for the rest of the previous period if the new one is shorter */
+        if (context->chRateCnt[chId] >= rateDiv)
+        {
+            context->chRateCnt[chId] = (uint8_t)(rateDiv - 1u);
         }
+        Cy_SysLib_ExitCriticalSection(interruptState);
+        result = CY_CSDADC_SUCCESS;
     }
+
     return (result);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_MeasureVdda
+* Function Name: Cy_CSDADC_SetChannelAcqTime
 ****************************************************************************//**
 *
-* The function measures a VDDA voltage and returns the result in millivolts.
+* Sets the acquisition time of the specified channel.
 *
-* This function measures the device supply voltage (VDDA) without the need
-* of explicitly connecting VDDA to a GPIO input of ADC. This capability
-* can be used to measure the battery voltage and/or change VDDA-dependent
-* parameters of the ADC during run-time.
+* By default, every channel is converted with the acqTime of
+* the \ref cy_stc_csdadc_config_t structure. This function sets a longer
+* acquisition time for the channels with the high-impedance sources or
+* a shorter one for the low-impedance sources, so the acquisition time of
+* the whole scan is not sized for the slowest source. The acquisition time
+* is converted to the sense clock cycles with the sense clock divider
+* calculated for the acqTime and azTime of the configuration and must
+* result in 1 to \ref CY_CSDADC_MAX_SNSCLK_CYCLES cycles.
 *
-* The conversion is initiated only if the CSDADC is in the IDLE state and
-* the context parameter is not NULL. This function is a blocking function,
-* i.e. waits for ADC conversion to be completed prior to returning to caller.
+* The function can be called at any time. If a conversion is in progress,
+* the new acquisition time applies starting from the next conversion of
+* the channel. The acquisition times are set to acqTime by
+* the Cy_CSDADC_Init() and Cy_CSDADC_WriteConfig() functions.
+*
+* \param chId
+* The ID of the channel.
+*
+* \param acqTime
+* The acquisition time in us. The valid range is 1 to
+* \ref CY_CSDADC_MAX_ACQ_TIME.
 *
 * \param context
-* The pointer to the CSDADC middleware context structure.
+* The pointer to the CSDADC context structure.
 *
 * \return
-* The function returns measurement result, VDDA in millivolts.
-* If the pointer to the CSDADC context is equal to NULL or ADC is not in IDLE
-* state, \ref CY_CSDADC_MEASUREMENT_FAILED is returned.
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The acquisition time is set.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL, the channel ID
+*                           is invalid, the acquisition time exceeds
+*                           \ref CY_CSDADC_MAX_ACQ_TIME, or it is out of
+*                           the range of the sense clock divider.
 *
 *******************************************************************************/
-uint32_t Cy_CSDADC_MeasureVdda(cy_stc_csdadc_context_t * context)
+cy_en_csdadc_status_t Cy_CSDADC_SetChannelAcqTime(
+                uint32_t chId,
+                uint32_t acqTime,
+                cy_stc_csdadc_context_t * context)
 {
-    CSD_Type * ptrCsdBaseAdd;
-
-    uint32_t interruptState;
-
-    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
-    uint32_t tmpResult;
-
-    uint32_t timeVssa2Vref;
-    uint32_t timeVdda2Vref;
-    uint32_t timeRecover;
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t acqCycles;
 
     CY_ASSERT_L1(NULL != context);
 
-    if (NULL != context)
+    if ((NULL != context) && (chId < context->cfgCopy.numChannels) &&
+        (CY_CSDADC_MAX_ACQ_TIME >= acqTime) &&
+        (0u != context->cfgCopy.operClkDivider) && (0u != context->snsClkDivider))
     {
-        if(CY_CSDADC_SUCCESS == Cy_CSDADC_IsEndConversion(context))
+        acqCycles = (acqTime * (context->cfgCopy.periClk / CY_CSDADC_MEGA)) /
+                                (uint32_t)context->cfgCopy.operClkDivider / (uint32_t)context->snsClkDivider;
+        if ((0u != acqCycles) && (CY_CSDADC_MAX_SNSCLK_CYCLES >= acqCycles))
         {
-            ptrCsdBaseAdd = context->cfgCopy.base;
-
-            /* Set the busy bit of the CSDADC status byte */
-            context->status |= CY_CSDADC_STATUS_BUSY_MASK;
-
-            /* Mask all CSD HW block interrupts (disable all interrupts) */
-            ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
-
-            /* Clear all pending interrupts of the CSD HW block */
-            ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
-            (void)ptrCsdBaseAdd->INTR;
-
-            /* Disconnect channels if connected */
-            if (CY_CSDADC_NO_CHANNEL != context->activeCh)
-            {
-                /* Disconnect existing input channel */
-                Cy_CSDADC_ClearChannels(context);
-                context->activeCh = CY_CSDADC_NO_CHANNEL;
-            }
-
-            /* Configure IDAC */
-            ptrCsdBaseAdd->IDACB = CY_CSDADC_IDACB_CONFIG | context->cfgCopy.idac;
-
-            /* Start CALIBPH1 */
-            /* Start CSDADC conversion */
-            tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREF, context);
-            if (CY_CSDADC_MEASUREMENT_FAILED != tmpResult)
-            {
-                /* Select the result value */
-                timeVssa2Vref = tmpResult & CY_CSDADC_ADC_RES_VALUE_MASK;
-
-                /* Start CALIBPH2 */
-                /* Set the mode and acquisition time and start CSDADC conversion */
-                tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREFBY2, context);
-                if (CY_CSDADC_MEASUREMENT_FAILED != tmpResult)
-                {
-                    /* Select the result value */
-                    timeRecover = tmpResult & CY_CSDADC_ADC_RES_VALUE_MASK;
-
-                    /* Disconnect amuxbusB, Connect VDDA to csdbusB */
-                    interruptState = Cy_SysLib_EnterCriticalSection();
-                    ptrCsdBaseAdd->SW_BYP_SEL &= (uint32_t)(~CY_CSDADC_SW_BYP_DEFAULT);
-                    Cy_SysLib_ExitCriticalSection(interruptState);
-                    ptrCsdBaseAdd->SW_SHIELD_SEL = CY_CSDADC_SW_SHIELD_VDDA2CSDBUSB;
-
-                    /* Start CALIBPH3 */
-                    tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VIN, context);
-                    if (CY_CSDADC_MEASUREMENT_FAILED != tmpResult)
-                    {
-                        /* Select the result value */
-                        timeVdda2Vref = tmpResult & CY_CSDADC_ADC_RES_VALUE_MASK;
-                        /* Reconnect amuxbusB, disconnect VDDA */
-                        ptrCsdBaseAdd->SW_SHIELD_SEL = CY_CSDADC_SW_SHIELD_DEFAULT;
-                        interruptState = Cy_SysLib_EnterCriticalSection();
-                        ptrCsdBaseAdd->SW_BYP_SEL |= CY_CSDADC_SW_BYP_DEFAULT;
-                        Cy_SysLib_ExitCriticalSection(interruptState);
-
-                        /* Calibrate timeVdda2Vref with Sink/Source mismatch with rounding */
-                        timeVdda2Vref = ((((timeVdda2Vref << 1u) * timeRecover) + (timeVssa2Vref >> 1u)) /
-                                                                                                    timeVssa2Vref);
-                        /* Calculate Vdda and store it in the context structure */
-                        tmpRetVal = context->vRefMv + (((context->vRefMv * timeVdda2Vref) + (timeVssa2Vref >> 1u)) /
-                                                                                                    timeVssa2Vref);
-                        context->vddaMv = (uint16_t)tmpRetVal;
-                    }
-                }
-            }
-            /* Set the idle status */
-            context->status = (uint16_t)CY_CSDADC_INIT_MASK;
+            context->chAcqCycles[chId] = (uint8_t)acqCycles;
+            result = CY_CSDADC_SUCCESS;
         }
     }
-    return (tmpRetVal);
+
+    return (result);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_MeasureAMuxB
+* Function Name: Cy_CSDADC_StreamEnable
 ****************************************************************************//**
 *
-* The function measures an AMUX-B voltage and returns the result in millivolts.
+* Enables the streaming mode.
 *
-* This function measures a voltage on AMUX-B without the need for explicitly
-* connecting a GPIO input to the CSDADC. This capability can be used to
-* measure an internal voltage connectable to AMUX-B. It is the responsibility
-* of the application program to establish connection between a voltage
-* source and AMUX-B prior to initiating a conversion with this function.
+* In the streaming mode, the CSDADC interrupt handler appends every
+* converted sample (channel ID, ADC code and cycle number) to the
+* specified ring buffer in addition to updating the most recent channel
+* result. The application drains the buffer at its own pace by the
+* Cy_CSDADC_StreamRead() function. If the buffer is full, the new sample
+* is dropped and counted, refer to Cy_CSDADC_StreamGetOverrun().
+*
+* The streaming mode is disabled by the Cy_CSDADC_Init() and
+* Cy_CSDADC_WriteConfig() functions.
+*
+* \param buffer
+* The pointer to the stream buffer allocated by the application.
+*
+* \param size
+* The number of samples in the stream buffer. Must be a power of two.
 *
 * \param context
-* The pointer to the CSDADC middleware context structure.
+* The pointer to the CSDADC context structure.
 *
 * \return
-* The function returns the result of an analog MuxBusB voltage measuring
-* in millivolts. If the pointer to the CSDADC context is equal to NULL
-* or ADC is not in the idle state, CY_CSDADC_MEASUREMENT_FAILED is returned.
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The streaming mode is enabled and the buffer is
+*                           empty.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL or the size is not a power of two.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
 *
 *******************************************************************************/
-uint32_t Cy_CSDADC_MeasureAMuxB(cy_stc_csdadc_context_t * context)
+cy_en_csdadc_status_t Cy_CSDADC_StreamEnable(
+                cy_stc_csdadc_sample_t * buffer,
+                uint32_t size,
+                cy_stc_csdadc_context_t * context)
 {
-    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
-    uint32_t polarity;
-    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
-    CSD_Type * ptrCsdBaseAdd;
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
 
+    CY_ASSERT_L1(NULL != buffer);
     CY_ASSERT_L1(NULL != context);
 
-    if (NULL != context)
+    if ((NULL != buffer) && (NULL != context) && (0u != size) && (0u == (size & (size - 1u))))
     {
-        if(CY_CSDADC_SUCCESS == Cy_CSDADC_IsEndConversion(context))
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
         {
-            ptrCsdBaseAdd = context->cfgCopy.base;
-
-            /* Check whether CSDADC is configured */
-            if ((uint16_t)CY_CSDADC_INIT_DONE != (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
-            {
-                result = Cy_CSDADC_WriteConfig(&context->cfgCopy, context);
-            }
-            if (CY_CSDADC_SUCCESS == result)
-            {
-                /* Mask all CSD HW block interrupts (disable all interrupts) */
-                ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
-
-                /* Clear all pending interrupts of the CSD HW block */
-                ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
-                (void)ptrCsdBaseAdd->INTR;
-
-                /* Disconnect channels if connected */
-                if (CY_CSDADC_NO_CHANNEL != context->activeCh)
-                {
-                    /* Disconnect existing input channel */
-                    Cy_CSDADC_ClearChannels(context);
-                    context->activeCh = CY_CSDADC_NO_CHANNEL;
-                }
-
-                /* Configure IDAC */
-                ptrCsdBaseAdd->IDACB = CY_CSDADC_IDACB_CONFIG | context->cfgCopy.idac;
-
-                /* Set the busy bit of the CSDADC status byte */
-                context->status |= CY_CSDADC_STATUS_BUSY_MASK;
-
-                /* Start CSD sequencer */
-                tmpRetVal = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VIN, context);
-                if (CY_CSDADC_MEASUREMENT_FAILED != tmpRetVal)
-                {
-                    /* Select the polarity bit */
-                    polarity = tmpRetVal & CY_CSDADC_ADC_RES_HSCMPPOL_MASK;
-                    /* Select the result value */
-                    tmpRetVal &= CY_CSDADC_ADC_RES_VALUE_MASK;
-                    /* HSCMP polarity is 0:sink, 1:source */
-                    if(0u != polarity) /* Sourcing */
-                    {
-                        /* Saturate result at tVssa2Vref */
-                        tmpRetVal = (tmpRetVal > (uint32_t)context->tVssa2Vref) ? (uint32_t)context->tVssa2Vref : tmpRetVal;
-                        /* Scale result to Resolution range with rounding*/
-                        tmpRetVal = ((((uint32_t)context->tVssa2Vref - tmpRetVal) * context->codeMax) +
-                                     ((uint32_t)context->tFull >> 1u)) / (uint32_t)context->tFull;
-                    }
-                    else /* Sinking */
-                    {
-                        if (CY_CSDADC_RANGE_VDDA == context->cfgCopy.range)
-                        {
-                            /* Scale result with sink/source mismatch with rounding */
-                            tmpRetVal = (((uint32_t)((uint32_t)context->tRecover << 1u) * tmpRetVal) +
-                                                ((uint32_t)context->tVssa2Vref >> 1u)) / (uint32_t)context->tVssa2Vref;
-                            /* Saturate result at t_Vdda2Vref*/
-                            tmpRetVal = (tmpRetVal > (uint32_t)context->tVdda2Vref) ? (uint32_t)context->tVdda2Vref :
-                                                                                                            tmpRetVal;
-                            /* Scale result to Resolution range with rounding */
-                            tmpRetVal = ((((uint32_t)context->tVssa2Vref + tmpRetVal) * context->codeMax)  +
-                                                         ((uint32_t)context->tFull >> 1u)) / (uint32_t)context->tFull;
-                        }
-                        else
-                        {
-                            /* In vref mode, we are not supposed to be sinking. Saturate */
-                            tmpRetVal = ((uint32_t)context->tVssa2Vref * context->codeMax) / (uint32_t)context->tFull;
-                        }
-                    }
-                    /* Scale result to mV with rounding and store it */
-                    tmpRetVal = ((((uint32_t) context->vMaxMv) * tmpRetVal) +
-                                                     ((uint32_t)context->codeMax >> 1u)) / ((uint32_t)context->codeMax);
-                    context->vBusBMv = (uint16_t)(tmpRetVal);
-                }
-
-                /* Clear all status bits except the initialization bit */
-                context->status &= (uint16_t)CY_CSDADC_INIT_MASK;
-            }
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            context->stream.sizeMask = size - 1u;
+            context->stream.head = 0u;
+            context->stream.tail = 0u;
+            context->stream.overrunCnt = 0u;
+            context->stream.ptrBuf = buffer;
+            result = CY_CSDADC_SUCCESS;
         }
     }
 
-    return (tmpRetVal);
+    return (result);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_SetClkDivider
+* Function Name: Cy_CSDADC_StreamDisable
 ****************************************************************************//**
 *
-* Sets the modulator clock and then starts it.
-*
-* Do not call this function directly by the application program.
-* It is used by initialization widget APIs to configure and
-* enable the modulator clock.
+* Disables the streaming mode. The samples that are not read yet are lost.
 *
 * \param context
-* The pointer to the CSDADC middleware context structure.
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The streaming mode is disabled.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
 *
 *******************************************************************************/
-static void Cy_CSDADC_SetClkDivider(const cy_stc_csdadc_context_t * context)
+cy_en_csdadc_status_t Cy_CSDADC_StreamDisable(
+                cy_stc_csdadc_context_t * context)
 {
-    uint32_t dividerIndex = context->cfgCopy.periDivInd;
-    cy_en_divider_types_t dividerType = (cy_en_divider_types_t) context->cfgCopy.periDivTyp;
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
 
-    (void)Cy_SysClk_PeriphDisableDivider(dividerType, dividerIndex);
-    if ((CY_SYSCLK_DIV_8_BIT == dividerType) || (CY_SYSCLK_DIV_16_BIT == dividerType))
-    {
-        (void)Cy_SysClk_PeriphSetDivider(dividerType, dividerIndex,
-                                                    (uint32_t)context->cfgCopy.operClkDivider - 1u);
-    }
-    else
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
     {
-        (void)Cy_SysClk_PeriphSetFracDivider(dividerType, dividerIndex,
-                                                    (uint32_t)context->cfgCopy.operClkDivider - 1u, 0u);
+        context->stream.ptrBuf = NULL;
+        result = CY_CSDADC_SUCCESS;
     }
-    (void)Cy_SysClk_PeriphEnableDivider(dividerType, dividerIndex);
+
+    return (result);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_ClearChannels
+* Function Name: Cy_CSDADC_StreamRead
 ****************************************************************************//**
 *
-* Resets all the CSDADC channels to disconnected state.
+* Reads the oldest samples from the stream buffer.
 *
-* The function goes through all the CSDADC channels and disconnects the pin
-* and the analog muxbus B. Also, sets the pin Drive mode.
+* The function does not block and does not disable interrupts. It may be
+* called at any time, including when a conversion is in progress, but only
+* from a single execution context.
+*
+* \param samples
+* The pointer to the array to store the samples.
+*
+* \param maxNum
+* The maximum number of samples to read.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The number of samples read. 0 if the stream buffer is empty, the streaming
+* mode is disabled, or a pointer is NULL.
 *
 *******************************************************************************/
-static void Cy_CSDADC_ClearChannels(cy_stc_csdadc_context_t * context)
+uint32_t Cy_CSDADC_StreamRead(
+                cy_stc_csdadc_sample_t * samples,
+                uint32_t maxNum,
+                cy_stc_csdadc_context_t * context)
 {
-    uint32_t chId;
+    uint32_t num = 0u;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t index;
+    const cy_stc_csdadc_sample_t * ptrBuf;
 
-    for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+    CY_ASSERT_L1(NULL != samples);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != samples) && (NULL != context))
     {
-        Cy_CSDADC_SetAdcChannel(chId, CY_CSDADC_CHAN_DISCONNECT, context);
+        ptrBuf = context->stream.ptrBuf;
+        if (NULL != ptrBuf)
+        {
+            head = context->stream.head;
+            tail = context->stream.tail;
+            /* Read the samples only after the head index is read */
+            __DMB();
+            num = head - tail;
+            if (num > maxNum)
+            {
+                num = maxNum;
+            }
+            for (index = 0u; index < num; index++)
+            {
+                samples[index] = ptrBuf[(tail + index) & context->stream.sizeMask];
+            }
+            /* Release the samples only after they are read */
+            __DMB();
+            context->stream.tail = tail + num;
+        }
+    }
+
+    return (num);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StreamGetOverrun
+****************************************************************************//**
+*
+* Returns the number of samples lost because the stream buffer was full
+* since the streaming mode was enabled.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The number of lost samples. If the context parameter is equal to NULL,
+* CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_StreamGetOverrun(
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        tmpRetVal = context->stream.overrunCnt;
+    }
+
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_RawCaptureEnable
+****************************************************************************//**
+*
+* Enables the raw capture mode.
+*
+* In the raw capture mode, the CSDADC interrupt handler only appends
+* the raw ADC_RES value of every conversion to the specified ring buffer
+* and starts the next conversion. The results are scaled to ADC codes and
+* mV later, in the thread context, by the Cy_CSDADC_ProcessResults()
+* function. This shortens the interrupt handler at high conversion rates.
+* If the buffer is full, the new sample is dropped and counted, refer to
+* Cy_CSDADC_RawCaptureGetOverrun().
+*
+* The channel results are updated only by Cy_CSDADC_ProcessResults().
+* The stream buffer, the limit detection, the channel statistics,
+* the extended results and the result frames are not updated in the raw
+* capture mode. The raw samples are scaled with the current calibration
+* data, so process the captured samples before calling Cy_CSDADC_Calibrate().
+*
+* The raw capture mode is not supported with the oversampling or
+* the background calibration, including the pending refresh of the data
+* imported by the Cy_CSDADC_EnableWarm() function. Refresh the imported data
+* by the Cy_CSDADC_Calibrate() function before enabling the raw capture mode.
+* If the raw capture mode is enabled before Cy_CSDADC_EnableWarm(),
+* the imported data is not refreshed until it is disabled.
+* The raw capture mode is disabled by
+* the Cy_CSDADC_Init() and Cy_CSDADC_WriteConfig() functions.
+*
+* \param buffer
+* The pointer to the raw capture buffer allocated by the application.
+*
+* \param size
+* The number of samples in the raw capture buffer. Must be a power of two.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The raw capture mode is enabled and the buffer is
+*                           empty.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL, the size is not a power of two,
+*                           the oversampling or the background calibration
+*                           is enabled, or the refresh of the imported
+*                           calibration data is pending.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_RawCaptureEnable(
+                cy_stc_csdadc_raw_sample_t * buffer,
+                uint32_t size,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != buffer);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != buffer) && (NULL != context) && (0u != size) && (0u == (size & (size - 1u))) &&
+        (0u == context->cfgCopy.oversampling) && (0u == context->cfgCopy.calibrInterval) &&
+        (0u == context->calibrPending))
+    {
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            context->raw.sizeMask = size - 1u;
+            context->raw.head = 0u;
+            context->raw.tail = 0u;
+            context->raw.overrunCnt = 0u;
+            context->raw.ptrBuf = buffer;
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_RawCaptureDisable
+****************************************************************************//**
+*
+* Disables the raw capture mode. The samples that are not processed yet
+* are lost.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The raw capture mode is disabled.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_RawCaptureDisable(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            context->raw.ptrBuf = NULL;
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ProcessResults
+****************************************************************************//**
+*
+* Scales the samples captured in the raw capture mode and stores them
+* as the channel results.
+*
+* The function processes all samples captured since the previous call in
+* one batch, so when a channel is captured several times, its result is
+* the latest one. The function does not block and does not disable
+* interrupts. It may be called at any time, including when a conversion is
+* in progress, but only from a single execution context.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The number of processed samples. 0 if the raw capture buffer is empty,
+* the raw capture mode is disabled, or the context pointer is NULL.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_ProcessResults(
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t num = 0u;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t index;
+    uint32_t tmpResult;
+    uint32_t range;
+    const cy_stc_csdadc_raw_sample_t * ptrSample;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != context) && (NULL != context->raw.ptrBuf))
+    {
+        head = context->raw.head;
+        tail = context->raw.tail;
+        /* Read the samples only after the head index is read */
+        __DMB();
+        num = head - tail;
+        for (index = tail; index != head; index++)
+        {
+            ptrSample = &context->raw.ptrBuf[index & context->raw.sizeMask];
+            range = Cy_CSDADC_GetChRange((uint32_t)ptrSample->chId, context);
+            tmpResult = Cy_CSDADC_GetTime(ptrSample->adcRes & CY_CSDADC_ADC_RES_VALUE_MASK,
+                                          ptrSample->adcRes & CY_CSDADC_ADC_RES_HSCMPPOL_MASK, range, context);
+            tmpResult = Cy_CSDADC_ScaleResult(tmpResult, range, context);
+            context->adcResult[ptrSample->chId].code = (uint16_t)tmpResult;
+            context->adcResult[ptrSample->chId].mVolts = (uint16_t)Cy_CSDADC_CodeToMv(tmpResult, range, context);
+        }
+        /* Release the samples only after they are processed */
+        __DMB();
+        context->raw.tail = head;
+    }
+
+    return (num);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_RawCaptureGetOverrun
+****************************************************************************//**
+*
+* Returns the number of samples lost because the raw capture buffer was full
+* since the raw capture mode was enabled.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The number of lost samples. If the context parameter is equal to NULL,
+* CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_RawCaptureGetOverrun(
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        tmpRetVal = context->raw.overrunCnt;
+    }
+
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_LimitEnable
+****************************************************************************//**
+*
+* Enables the limit detection.
+*
+* The CSDADC interrupt handler compares every conversion result of
+* the channels specified by the limitMask parameter with the thresholds
+* of the channel and calls the limit callback once the limit state of
+* the channel changes. This allows reacting to an over- or under-voltage
+* within one conversion without polling the channel results.
+* The callback is called from the interrupt context, so it should be short.
+*
+* The limits array is indexed by the channel ID and must contain at least
+* as many items as the highest channel ID in limitMask plus one. The low,
+* high and hysteresis fields are specified by the application, the state
+* field is set to CY_CSDADC_LIMIT_INSIDE by this function and then
+* maintained by the middleware. The array must stay valid while the limit
+* detection is enabled.
+*
+* The limit detection is disabled by the Cy_CSDADC_Init() and
+* Cy_CSDADC_WriteConfig() functions.
+*
+* \param limits
+* The pointer to the channel limit array allocated by the application.
+*
+* \param limitMask
+* The mask of the channels to check.
+*
+* \param callbackFunction
+* The pointer to the limit callback function.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The limit detection is enabled.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL or the limitMask parameter
+*                           contains channels that are not configured.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_LimitEnable(
+                cy_stc_csdadc_limit_t * limits,
+                uint32_t limitMask,
+                cy_csdadc_limit_callback_t callbackFunction,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t chId;
+
+    CY_ASSERT_L1(NULL != limits);
+    CY_ASSERT_L1(NULL != callbackFunction);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != limits) && (NULL != callbackFunction) && (NULL != context) &&
+        (limitMask <= CY_CSDADC_CH_MASK_ALL(context->cfgCopy.numChannels)))
+    {
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+            {
+                if (0u != (limitMask & (1uL << chId)))
+                {
+                    limits[chId].state = CY_CSDADC_LIMIT_INSIDE;
+                }
+            }
+            context->limitMask = limitMask;
+            context->ptrLimitCallback = callbackFunction;
+            context->ptrLimit = limits;
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_LimitDisable
+****************************************************************************//**
+*
+* Disables the limit detection.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The limit detection is disabled.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_LimitDisable(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        context->ptrLimit = NULL;
+        result = CY_CSDADC_SUCCESS;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_CheckLimit
+****************************************************************************//**
+*
+* Updates the limit state of the channel with the new conversion result
+* and calls the limit callback if the state changes.
+*
+* \param chId
+* The ID of the converted channel.
+*
+* \param code
+* The conversion result in ADC codes.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_CheckLimit(
+                uint32_t chId,
+                uint32_t code,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_stc_csdadc_limit_t * ptrLimit = &context->ptrLimit[chId];
+    cy_en_csdadc_limit_state_t newState = ptrLimit->state;
+
+    /* Return into the window only beyond the hysteresis */
+    if (CY_CSDADC_LIMIT_ABOVE == newState)
+    {
+        if ((code + ptrLimit->hysteresis) < ptrLimit->high)
+        {
+            newState = CY_CSDADC_LIMIT_INSIDE;
+        }
+    }
+    else if (CY_CSDADC_LIMIT_BELOW == newState)
+    {
+        if (code > ((uint32_t)ptrLimit->low + ptrLimit->hysteresis))
+        {
+            newState = CY_CSDADC_LIMIT_INSIDE;
+        }
+    }
+    else
+    {
+        /* Already inside the window */
+    }
+
+    if (CY_CSDADC_LIMIT_INSIDE == newState)
+    {
+        if (code > ptrLimit->high)
+        {
+            newState = CY_CSDADC_LIMIT_ABOVE;
+        }
+        else if (code < ptrLimit->low)
+        {
+            newState = CY_CSDADC_LIMIT_BELOW;
+        }
+        else
+        {
+            /* Stay inside the window */
+        }
+    }
+
+    if (newState != ptrLimit->state)
+    {
+        ptrLimit->state = newState;
+        context->ptrLimitCallback(chId, newState, context);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StatEnable
+****************************************************************************//**
+*
+* Enables the channel statistics.
+*
+* The CSDADC interrupt handler accumulates the number, min, max, sum and
+* sum of squares of the conversion results of the channels specified by
+* the statMask parameter. This allows getting the mean and the noise of
+* a channel without copying its results after every conversion.
+*
+* The stats array is indexed by the channel ID and must contain at least
+* as many items as the highest channel ID in statMask plus one. The items
+* specified by statMask are cleared by this function. The array must stay
+* valid while the statistics are enabled.
+*
+* The statistics are disabled by the Cy_CSDADC_Init() and
+* Cy_CSDADC_WriteConfig() functions.
+*
+* \param stats
+* The pointer to the channel statistics array allocated by the application.
+*
+* \param statMask
+* The mask of the channels to accumulate the statistics.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The statistics are enabled.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL or the statMask parameter
+*                           contains channels that are not configured.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StatEnable(
+                cy_stc_csdadc_ch_stat_t * stats,
+                uint32_t statMask,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t chId;
+
+    CY_ASSERT_L1(NULL != stats);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != stats) && (NULL != context) &&
+        (statMask <= CY_CSDADC_CH_MASK_ALL(context->cfgCopy.numChannels)))
+    {
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+            {
+                if (0u != (statMask & (1uL << chId)))
+                {
+                    Cy_CSDADC_ClearStat(&stats[chId]);
+                }
+            }
+            context->statMask = statMask;
+            context->ptrStat = stats;
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StatDisable
+****************************************************************************//**
+*
+* Disables the channel statistics. The statistics array keeps
+* the accumulated values.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The statistics are disabled.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StatDisable(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        context->ptrStat = NULL;
+        result = CY_CSDADC_SUCCESS;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StatRead
+****************************************************************************//**
+*
+* Reads a consistent snapshot of the channel statistics.
+*
+* The statistics item is copied with the interrupts disabled, so the copy
+* is not torn by the CSDADC interrupt handler running in parallel.
+*
+* \param chId
+* The ID of the channel.
+*
+* \param stat
+* The pointer to the structure to store the channel statistics.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The statistics are read.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL, the statistics are disabled or
+*                           the channel is not in the statistics mask.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StatRead(
+                uint32_t chId,
+                cy_stc_csdadc_ch_stat_t * stat,
+                const cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != stat);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != stat) && (NULL != context) && (CY_CSDADC_MAX_CHAN_NUM > chId))
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        if ((NULL != context->ptrStat) && (0u != (context->statMask & (1uL << chId))))
+        {
+            *stat = context->ptrStat[chId];
+            result = CY_CSDADC_SUCCESS;
+        }
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StatReset
+****************************************************************************//**
+*
+* Clears the statistics of the specified channels. The channels keep
+* accumulating the statistics from the next conversion.
+*
+* \param chMask
+* The mask of the channels to clear. The channels that are not in
+* the statistics mask are ignored.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The statistics are cleared.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL or the statistics are
+*                           disabled.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StatReset(
+                uint32_t chMask,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
+    uint32_t tmpMask;
+    uint32_t chId;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        if (NULL != context->ptrStat)
+        {
+            tmpMask = chMask & context->statMask;
+            for (chId = 0u; 0u != tmpMask; chId++)
+            {
+                if (0u != (tmpMask & 1u))
+                {
+                    Cy_CSDADC_ClearStat(&context->ptrStat[chId]);
+                }
+                tmpMask >>= 1u;
+            }
+            result = CY_CSDADC_SUCCESS;
+        }
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_UpdateStat
+****************************************************************************//**
+*
+* Accumulates the new conversion result in the channel statistics.
+*
+* \param chId
+* The ID of the converted channel.
+*
+* \param code
+* The conversion result in ADC codes.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_UpdateStat(
+                uint32_t chId,
+                uint32_t code,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_stc_csdadc_ch_stat_t * ptrStat = &context->ptrStat[chId];
+
+    ptrStat->sum += code;
+    /* The code is at most 16 bits, so its square fits in 32 bits */
+    ptrStat->sumSq += (uint64_t)(code * code);
+    ptrStat->count++;
+    if (ptrStat->min > code)
+    {
+        ptrStat->min = (uint16_t)code;
+    }
+    if (ptrStat->max < code)
+    {
+        ptrStat->max = (uint16_t)code;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ClearStat
+****************************************************************************//**
+*
+* Clears the channel statistics item.
+*
+* \param stat
+* The pointer to the channel statistics item.
+*
+*******************************************************************************/
+static void Cy_CSDADC_ClearStat(
+                cy_stc_csdadc_ch_stat_t * stat)
+{
+    stat->sum = 0u;
+    stat->sumSq = 0u;
+    stat->count = 0u;
+    stat->min = CY_CSDADC_STAT_MIN_INIT;
+    stat->max = 0u;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ResultExtEnable
+****************************************************************************//**
+*
+* Enables the extended results.
+*
+* The CSDADC interrupt handler stores every channel result in the extended
+* result array together with the channel sequence number and the timestamp
+* of the result. The sequence number is incremented by each result of
+* the channel, so the application detects a stale or a stalled channel by
+* comparing it with the previously read value. The timestamp is provided by
+* the function registered by Cy_CSDADC_RegisterTimestamp() and is 0 if
+* the function is not registered.
+*
+* The results array is indexed by the channel ID and must contain
+* the number of items equal to the numChannels configuration parameter.
+* The array is cleared by this function and must stay valid while
+* the extended results are enabled.
+*
+* The extended results are disabled by the Cy_CSDADC_Init() and
+* Cy_CSDADC_WriteConfig() functions.
+*
+* \param results
+* The pointer to the extended result array allocated by the application.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The extended results are enabled.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_ResultExtEnable(
+                cy_stc_csdadc_result_ext_t * results,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t chId;
+
+    CY_ASSERT_L1(NULL != results);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != results) && (NULL != context))
+    {
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+            {
+                results[chId].seq = 0u;
+                results[chId].timestamp = 0u;
+                results[chId].code = 0u;
+                results[chId].mVolts = 0u;
+            }
+            context->ptrResultExt = results;
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ResultExtDisable
+****************************************************************************//**
+*
+* Disables the extended results.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The extended results are disabled.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_ResultExtDisable(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        context->ptrResultExt = NULL;
+        result = CY_CSDADC_SUCCESS;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetResultExt
+****************************************************************************//**
+*
+* Reads a consistent snapshot of the extended result of the channel.
+*
+* The result is copied with the interrupts disabled, so the code, voltage,
+* sequence number and timestamp always belong to the same conversion.
+*
+* \param chId
+* The ID of the channel.
+*
+* \param result
+* The pointer to the structure to store the extended result.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The extended result is read.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL, the extended results are
+*                           disabled or the channel is not configured.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_GetResultExt(
+                uint32_t chId,
+                cy_stc_csdadc_result_ext_t * result,
+                const cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t retVal = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != result);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != result) && (NULL != context) && ((uint32_t)context->cfgCopy.numChannels > chId))
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        if (NULL != context->ptrResultExt)
+        {
+            *result = context->ptrResultExt[chId];
+            retVal = CY_CSDADC_SUCCESS;
+        }
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_FrameEnable
+****************************************************************************//**
+*
+* Enables the result frames.
+*
+* The CSDADC interrupt handler stores the channel results of the current
+* enabled channels cycle in a back frame and publishes the frame as
+* the latest one once the cycle is complete. The application gets
+* the latest complete frame by the Cy_CSDADC_GetLatestFrame() function
+* without disabling the interrupts, so the results of the different channels
+* used in one computation always belong to the same cycle.
+*
+* With three frames, the frame returned by Cy_CSDADC_GetLatestFrame() is
+* not modified until the next Cy_CSDADC_GetLatestFrame() call. With two
+* frames, the returned frame is not modified until the end of the next
+* enabled channels cycle, so it should be processed within one cycle.
+*
+* The result frames are disabled by the Cy_CSDADC_Init() and
+* Cy_CSDADC_WriteConfig() functions.
+*
+* \param frames
+* The pointer to the frame array allocated by the application.
+* The array must stay valid while the result frames are enabled.
+*
+* \param frameNum
+* The number of frames in the array, CY_CSDADC_FRAME_NUM_MIN or
+* CY_CSDADC_FRAME_NUM_MAX.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The result frames are enabled.
+* * CY_CSDADC_BAD_PARAM   - A pointer is NULL or the frameNum parameter is
+*                           invalid.
+* * CY_CSDADC_HW_BUSY     - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_FrameEnable(
+                cy_stc_csdadc_frame_t * frames,
+                uint32_t frameNum,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t frameIndex;
+
+    CY_ASSERT_L1(NULL != frames);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != frames) && (NULL != context) &&
+        (CY_CSDADC_FRAME_NUM_MIN <= frameNum) && (CY_CSDADC_FRAME_NUM_MAX >= frameNum))
+    {
+        if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            for (frameIndex = 0u; frameIndex < frameNum; frameIndex++)
+            {
+                frames[frameIndex].cycle = 0u;
+                frames[frameIndex].chMask = 0u;
+            }
+            context->frameNum = (uint8_t)frameNum;
+            context->frameWrite = 0u;
+            context->frameLatest = CY_CSDADC_NO_FRAME;
+            context->frameRead = CY_CSDADC_NO_FRAME;
+            context->ptrFrame = frames;
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_FrameDisable
+****************************************************************************//**
+*
+* Disables the result frames.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The result frames are disabled.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_FrameDisable(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        context->ptrFrame = NULL;
+        result = CY_CSDADC_SUCCESS;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetLatestFrame
+****************************************************************************//**
+*
+* Returns the latest complete result frame.
+*
+* The returned frame is reserved for reading, refer to
+* Cy_CSDADC_FrameEnable() for how long it stays unchanged.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The pointer to the latest complete frame or NULL if the result frames
+* are disabled or no enabled channels cycle is complete yet.
+*
+*******************************************************************************/
+const cy_stc_csdadc_frame_t * Cy_CSDADC_GetLatestFrame(
+                cy_stc_csdadc_context_t * context)
+{
+    const cy_stc_csdadc_frame_t * ptrFrame = NULL;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        if ((NULL != context->ptrFrame) && (CY_CSDADC_NO_FRAME != context->frameLatest))
+        {
+            context->frameRead = context->frameLatest;
+            ptrFrame = &context->ptrFrame[context->frameRead];
+        }
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    return (ptrFrame);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_FlipFrame
+****************************************************************************//**
+*
+* Publishes the back frame as the latest one and selects the next back frame
+* that is neither the latest nor the reserved for reading one if possible.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_FlipFrame(
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t frameIndex;
+    uint32_t nextFrame = CY_CSDADC_NO_FRAME;
+    uint32_t latestFrame = context->frameWrite;
+
+    context->ptrFrame[latestFrame].cycle = context->counter & CY_CSDADC_COUNTER_CYCLE_MASK;
+    context->frameLatest = (uint8_t)latestFrame;
+
+    for (frameIndex = 0u; frameIndex < context->frameNum; frameIndex++)
+    {
+        if ((frameIndex != latestFrame) &&
+            ((CY_CSDADC_NO_FRAME == nextFrame) || (frameIndex != (uint32_t)context->frameRead)))
+        {
+            nextFrame = frameIndex;
+        }
+    }
+
+    context->frameWrite = (uint8_t)nextFrame;
+    context->ptrFrame[nextFrame].chMask = 0u;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_Restore
+****************************************************************************//**
+*
+* Resumes the middleware operation if the Cy_CSDADC_Save() function was
+* called previously.
+*
+* This function, along with the Cy_CSDADC_Save() function, is specifically
+* designed for ease of use and supports time multiplexing of the CSD HW block
+* among multiple middleware. When the CSD HW block is shared by two or more
+* middleware, this function can be used to restore the previous state of
+* the CSD HW block and CSDADC middleware saved using the
+* Cy_CSDACD_Save() function.
+* This function performs a sub-set of initialization tasks and is used into the
+* Cy_CSDADC_Init() function.
+*
+* The whole CSD HW block register image is built from the context structure
+* and written by a single Cy_CSD_Init() call. The peripheral clock divider is
+* reprogrammed only if it was changed by another middleware.
+*
+* If the calibrTolerance configuration parameter is not zero and the CSDADC
+* is initialized, the function checks the calibration data by one (Vref range) or two (Vdda range)
+* conversions and recalibrates the CSDADC only if the calibration times
+* drifted beyond the tolerance, e.g. because of Vdda or temperature change.
+* The check and the recalibration poll the CSD HW block, so they do not need
+* the CSDADC interrupt and can be performed before the application switches
+* the CSD interrupt to the CSDADC interrupt handler.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* Returns the status of the resume process. If CY_CSDADC_SUCCESS is not
+* received, the resume process fails and a retry may be required.
+* CY_CSDADC_CALIBRATION_FAIL is returned if the required recalibration fails.
+* In this case, the CSD HW block stays captured by the CSDADC with the previous
+* calibration data, so the application calls Cy_CSDADC_Calibrate() after
+* switching the CSD interrupt to the CSDADC interrupt handler, or releases
+* the CSD HW block by Cy_CSDADC_Save() before the retry.
+*
+* \funcusage
+*
+* An example of sharing the CSD HW block by CAPSENSE&trade; and CSDADC middleware:
+* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_TimeMultiplex
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_Restore(cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    uint32_t watchdogCounter;
+    cy_en_csd_key_t mvKey;
+    cy_en_csd_status_t initStatus = CY_CSD_LOCKED;
+    cy_stc_csd_config_t csdCfg = CY_CSDADC_CSD_CONFIG_DEFAULT;
+    CSD_Type * ptrCsdBaseAdd;
+    cy_stc_csd_context_t * ptrCsdCxt;
+
+    /* Number of cycle of one for() loop */
+    const uint32_t cyclesPerLoop = 5u;
+    /* Timeout in microseconds */
+    const uint32_t watchdogTimeoutUs = 10000u;
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        uint32_t startTime;
+    #endif
+
+    if (NULL != context)
+    {
+        #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+            startTime = Cy_CSDADC_GetTimestamp(context);
+        #endif
+        ptrCsdBaseAdd = context->cfgCopy.base;
+        ptrCsdCxt = context->cfgCopy.csdCxtPtr;
+
+        result = CY_CSDADC_HW_LOCKED;
+
+        /* Get the CSD HW block status */
+        mvKey = Cy_CSD_GetLockStatus(ptrCsdBaseAdd, ptrCsdCxt);
+        if(CY_CSD_NONE_KEY == mvKey)
+        {
+            ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
+            ptrCsdBaseAdd->SEQ_START = CY_CSDADC_FSM_ABORT;
+
+            /* Initialize Watchdog Counter to prevent a hang */
+            watchdogCounter = (watchdogTimeoutUs * (context->cfgCopy.cpuClk / CY_CSDADC_MEGA)) / cyclesPerLoop;
+            do
+            {
+                initStatus = Cy_CSD_GetConversionStatus(ptrCsdBaseAdd, ptrCsdCxt);
+                watchdogCounter--;
+            }
+            while((CY_CSD_BUSY == initStatus) && (0u != watchdogCounter));
+
+            /* Clear all interrupt pending requests */
+            ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
+            (void)ptrCsdBaseAdd->INTR;
+
+            /* Set idle status */
+            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
+            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+
+            /* Capture the CSD HW block for the ADC functionality and configure it at once */
+            Cy_CSDADC_SetCsdConfig(&csdCfg, context);
+            initStatus = Cy_CSD_Init(ptrCsdBaseAdd, &csdCfg, CY_CSD_ADC_KEY, ptrCsdCxt);
+
+            if (CY_CSD_SUCCESS == initStatus)
+            {
+                /* Configure clocks */
+                Cy_CSDADC_SetClkDivider(context);
+                result = CY_CSDADC_SUCCESS;
+
+                if ((0u != context->cfgCopy.calibrTolerance) &&
+                    ((uint16_t)CY_CSDADC_INIT_DONE == (context->status & (uint16_t)CY_CSDADC_INIT_MASK)))
+                {
+                    result = Cy_CSDADC_CheckCalibration(context);
+                }
+            }
+        }
+        #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+            Cy_CSDADC_UpdatePhaseStat(CY_CSDADC_PHASE_RESTORE, Cy_CSDADC_GetTimestamp(context) - startTime, context);
+        #endif
+    }
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_MeasureVdda
+****************************************************************************//**
+*
+* The function measures a VDDA voltage and returns the result in millivolts.
+*
+* This function measures the device supply voltage (VDDA) without the need
+* of explicitly connecting VDDA to a GPIO input of ADC. This capability
+* can be used to measure the battery voltage and/or change VDDA-dependent
+* parameters of the ADC during run-time.
+*
+* The conversion is initiated only if the CSDADC is in the IDLE state and
+* the context parameter is not NULL. This function is a blocking function,
+* i.e. waits for ADC conversion to be completed prior to returning to caller.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns measurement result, VDDA in millivolts.
+* If the pointer to the CSDADC context is equal to NULL or ADC is not in IDLE
+* state, \ref CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_MeasureVdda(cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+    uint32_t tmpResult;
+
+    uint32_t timeVssa2Vref;
+    uint32_t timeVdda2Vref;
+    uint32_t timeRecover;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        if(CY_CSDADC_SUCCESS == Cy_CSDADC_IsEndConversion(context))
+        {
+            /* Disconnect channels, configure IDAC, and set the busy status */
+            Cy_CSDADC_PrepareMeasurement(context);
+
+            /* Start CALIBPH1 */
+            /* Start CSDADC conversion */
+            tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREF, context);
+            if (CY_CSDADC_MEASUREMENT_FAILED != tmpResult)
+            {
+                /* Select the result value */
+                timeVssa2Vref = tmpResult & CY_CSDADC_ADC_RES_VALUE_MASK;
+
+                /* Start CALIBPH2 */
+                /* Set the mode and acquisition time and start CSDADC conversion */
+                tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREFBY2, context);
+                if (CY_CSDADC_MEASUREMENT_FAILED != tmpResult)
+                {
+                    /* Select the result value */
+                    timeRecover = tmpResult & CY_CSDADC_ADC_RES_VALUE_MASK;
+
+                    /* Disconnect amuxbusB, Connect VDDA to csdbusB */
+                    Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_CONNECT, context);
+
+                    /* Start CALIBPH3 */
+                    tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VIN, context);
+                    if (CY_CSDADC_MEASUREMENT_FAILED != tmpResult)
+                    {
+                        /* Select the result value */
+                        timeVdda2Vref = tmpResult & CY_CSDADC_ADC_RES_VALUE_MASK;
+                        /* Reconnect amuxbusB, disconnect VDDA */
+                        Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, context);
+
+                        /* Calculate Vdda and store it in the context structure */
+                        tmpRetVal = Cy_CSDADC_CalcVdda(timeVssa2Vref, timeRecover, timeVdda2Vref, context);
+                        context->vddaMv = (uint16_t)tmpRetVal;
+                    }
+                }
+            }
+            /* Set the idle status */
+            context->status = (uint16_t)CY_CSDADC_INIT_MASK;
+        }
+    }
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_MeasureAMuxB
+****************************************************************************//**
+*
+* The function measures an AMUX-B voltage and returns the result in millivolts.
+*
+* This function measures a voltage on AMUX-B without the need for explicitly
+* connecting a GPIO input to the CSDADC. This capability can be used to
+* measure an internal voltage connectable to AMUX-B. It is the responsibility
+* of the application program to establish connection between a voltage
+* source and AMUX-B prior to initiating a conversion with this function.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the result of an analog MuxBusB voltage measuring
+* in millivolts. If the pointer to the CSDADC context is equal to NULL
+* or ADC is not in the idle state, CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_MeasureAMuxB(cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        if(CY_CSDADC_SUCCESS == Cy_CSDADC_IsEndConversion(context))
+        {
+            /* Check whether CSDADC is configured */
+            if ((uint16_t)CY_CSDADC_INIT_DONE != (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
+            {
+                result = Cy_CSDADC_WriteConfig(&context->cfgCopy, context);
+            }
+            if (CY_CSDADC_SUCCESS == result)
+            {
+                /* Disconnect channels, configure IDAC, and set the busy status */
+                Cy_CSDADC_PrepareMeasurement(context);
+
+                /* Start CSD sequencer */
+                tmpRetVal = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VIN, context);
+                if (CY_CSDADC_MEASUREMENT_FAILED != tmpRetVal)
+                {
+                    /* Scale result to mV and store it */
+                    tmpRetVal = Cy_CSDADC_ResultToMv(tmpRetVal & CY_CSDADC_ADC_RES_VALUE_MASK,
+                                                     tmpRetVal & CY_CSDADC_ADC_RES_HSCMPPOL_MASK, context);
+                    context->vBusBMv = (uint16_t)(tmpRetVal);
+                }
+
+                /* Clear all status bits except the initialization bit */
+                context->status &= (uint16_t)CY_CSDADC_INIT_MASK;
+            }
+        }
+    }
+
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StartMeasureVdda
+****************************************************************************//**
+*
+* Initiates a VDDA voltage measurement.
+*
+* This is the non-blocking version of the Cy_CSDADC_MeasureVdda() function.
+* The function starts the first of three measurement phases and returns.
+* The next phases and the VDDA calculation are performed by the CSDADC
+* interrupt handler. Use the Cy_CSDADC_IsEndConversion() function to check
+* whether the measurement is complete and the Cy_CSDADC_GetVdda() function to
+* read the result.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS         - The measurement is started.
+* * CY_CSDADC_HW_BUSY         - The measurement is not started. The previously
+*                               initiated conversion is in progress.
+* * CY_CSDADC_BAD_PARAM       - The context pointer is NULL.
+* * CY_CSDADC_NOT_INITIALIZED - CSDADC to be initialized by using the
+*                               Cy_CSDADC_Init() and Cy_CSDADC_Enable()
+*                               functions.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StartMeasureVdda(cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        if ((uint16_t)CY_CSDADC_INIT_DONE != (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
+        {
+            result = CY_CSDADC_NOT_INITIALIZED;
+        }
+        else if (CY_CSDADC_SUCCESS != Cy_CSDADC_IsEndConversion(context))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            /* Disconnect channels, configure IDAC, and set the busy status */
+            Cy_CSDADC_PrepareMeasurement(context);
+            /* Set CSDADC FSM status */
+            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+            context->status |= (uint16_t)CY_CSDADC_STATUS_VDDAPH1;
+            Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VREF, context);
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StartMeasureAMuxB
+****************************************************************************//**
+*
+* Initiates an AMUX-B voltage measurement.
+*
+* This is the non-blocking version of the Cy_CSDADC_MeasureAMuxB() function.
+* The function starts the measurement and returns. The result is calculated
+* by the CSDADC interrupt handler. Use the Cy_CSDADC_IsEndConversion() function
+* to check whether the measurement is complete and the Cy_CSDADC_GetAMuxB()
+* function to read the result.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS         - The measurement is started.
+* * CY_CSDADC_HW_BUSY         - The measurement is not started. The previously
+*                               initiated conversion is in progress.
+* * CY_CSDADC_BAD_PARAM       - The context pointer is NULL.
+* * CY_CSDADC_NOT_INITIALIZED - CSDADC to be initialized by using the
+*                               Cy_CSDADC_Init() and Cy_CSDADC_Enable()
+*                               functions.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StartMeasureAMuxB(cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        if ((uint16_t)CY_CSDADC_INIT_DONE != (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
+        {
+            result = CY_CSDADC_NOT_INITIALIZED;
+        }
+        else if (CY_CSDADC_SUCCESS != Cy_CSDADC_IsEndConversion(context))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            /* Disconnect channels, configure IDAC, and set the busy status */
+            Cy_CSDADC_PrepareMeasurement(context);
+            /* Set CSDADC FSM status */
+            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+            context->status |= (uint16_t)CY_CSDADC_STATUS_AMUXB;
+            Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, context);
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetVdda
+****************************************************************************//**
+*
+* Returns the most recent VDDA measurement result in millivolts.
+*
+* The result is updated by the Cy_CSDADC_MeasureVdda() function or
+* by the measurement initiated by the Cy_CSDADC_StartMeasureVdda() function.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The VDDA voltage in millivolts. If the context parameter is equal to NULL,
+* CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_GetVdda(const cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        tmpRetVal = context->vddaMv;
+    }
+
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetAMuxB
+****************************************************************************//**
+*
+* Returns the most recent AMUX-B voltage measurement result in millivolts.
+*
+* The result is updated by the Cy_CSDADC_MeasureAMuxB() function or
+* by the measurement initiated by the Cy_CSDADC_StartMeasureAMuxB() function.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The AMUX-B voltage in millivolts. If the context parameter is equal to NULL,
+* CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_GetAMuxB(const cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        tmpRetVal = context->vBusBMv;
+    }
+
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SetClkDivider
+****************************************************************************//**
+*
+* Sets the modulator clock and then starts it.
+*
+* Do not call this function directly by the application program.
+* It is used by initialization widget APIs to configure and
+* enable the modulator clock.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SetClkDivider(const cy_stc_csdadc_context_t * context)
+{
+    uint32_t dividerIndex = context->cfgCopy.periDivInd;
+    cy_en_divider_types_t dividerType = (cy_en_divider_types_t) context->cfgCopy.periDivTyp;
+    uint32_t dividerValue = (uint32_t)context->cfgCopy.operClkDivider - 1u;
+    uint32_t intValue;
+    uint32_t fracValue = 0u;
+
+    if ((CY_SYSCLK_DIV_8_BIT == dividerType) || (CY_SYSCLK_DIV_16_BIT == dividerType))
+    {
+        intValue = Cy_SysClk_PeriphGetDivider(dividerType, dividerIndex);
+    }
+    else
+    {
+        Cy_SysClk_PeriphGetFracDivider(dividerType, dividerIndex, &intValue, &fracValue);
+    }
+
+    /* Reprogram the divider only if it was changed, e.g. by another middleware */
+    if ((dividerValue != intValue) || (0u != fracValue))
+    {
+        (void)Cy_SysClk_PeriphDisableDivider(dividerType, dividerIndex);
+        if ((CY_SYSCLK_DIV_8_BIT == dividerType) || (CY_SYSCLK_DIV_16_BIT == dividerType))
+        {
+            (void)Cy_SysClk_PeriphSetDivider(dividerType, dividerIndex, dividerValue);
+        }
+        else
+        {
+            (void)Cy_SysClk_PeriphSetFracDivider(dividerType, dividerIndex, dividerValue, 0u);
+        }
+    }
+    (void)Cy_SysClk_PeriphEnableDivider(dividerType, dividerIndex);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SetCsdConfig
+****************************************************************************//**
+*
+* Fills the CSD HW block register image for the CSDADC operation.
+*
+* The image contains the same register values as written by
+* the Cy_CSDADC_Configure() function, so the CSD HW block is configured
+* by a single Cy_CSD_Init() call.
+*
+* \param csdCfg
+* The pointer to the CSD configuration structure initialized with
+* CY_CSDADC_CSD_CONFIG_DEFAULT.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SetCsdConfig(
+                cy_stc_csd_config_t * csdCfg,
+                const cy_stc_csdadc_context_t * context)
+{
+    csdCfg->sensePeriod = (uint32_t)context->snsClkDivider - 1u;
+
+    csdCfg->config = CY_CSDADC_CSD_REG_CONFIG_DEFAULT;
+    csdCfg->idacB = CY_CSDADC_IDACB_CONFIG | context->cfgCopy.idac;
+    csdCfg->seqTime = (uint32_t)context->azCycles - 1u;
+
+    csdCfg->csdCmp = 0u;
+    csdCfg->swDsiSel = 0u;
+    csdCfg->senseDuty = 0u;
+    csdCfg->seqInitCnt = 1u;
+    csdCfg->seqNormCnt = 2u;
+
+    csdCfg->swHsPosSel = CY_CSDADC_SW_HSP_DEFAULT;
+    csdCfg->swHsNegSel = CY_CSDADC_SW_HSN_DEFAULT;
+    csdCfg->swShieldSel = CY_CSDADC_SW_SHIELD_DEFAULT;
+    csdCfg->swCmpPosSel = CY_CSDADC_SW_CMPP_DEFAULT;
+    csdCfg->swCmpNegSel = CY_CSDADC_SW_CMPN_DEFAULT;
+    csdCfg->swFwModSel = CY_CSDADC_SW_FWMOD_DEFAULT;
+    csdCfg->swFwTankSel = CY_CSDADC_SW_FWTANK_DEFAULT;
+    csdCfg->swRefgenSel = CY_CSDADC_SW_REFGEN_SGR_SRSS;
+    csdCfg->swBypSel = CY_CSDADC_SW_BYP_DEFAULT;
+
+    csdCfg->refgen = CY_CSDADC_REFGEN_NORM | ((uint32_t)(context->vRefGain) << CY_CSDADC_REFGEN_GAIN_SHIFT);
+    csdCfg->swAmuxbufSel = CY_CSDADC_SW_AMUBUF_NORM;
+    csdCfg->hscmp = CY_CSDADC_HSCMP_AZ_DEFAULT;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_IsDriftInRange
+****************************************************************************//**
+*
+* Checks whether the measured time differs from the calibration time
+* by no more than the calibrTolerance configuration parameter.
+*
+* \param adcResult
+* The ADC_RES register value or CY_CSDADC_MEASUREMENT_FAILED.
+*
+* \param calibrTime
+* The time stored by the last calibration.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* 1 if the drift is in the range, otherwise 0.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_IsDriftInRange(
+                uint32_t adcResult,
+                uint32_t calibrTime,
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t retVal = 0u;
+    uint32_t time = adcResult & CY_CSDADC_ADC_RES_VALUE_MASK;
+    uint32_t maxDrift = (calibrTime * context->cfgCopy.calibrTolerance) / CY_CSDADC_CALIBR_TOLERANCE_SCALE;
+
+    if ((CY_CSDADC_MEASUREMENT_FAILED != adcResult) &&
+        ((time + maxDrift) >= calibrTime) && (time <= (calibrTime + maxDrift)))
+    {
+        retVal = 1u;
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_CheckCalibration
+****************************************************************************//**
+*
+* Repeats the calibration phases that do not depend on the Sink/Source
+* mismatch and recalibrates the CSDADC if the results drifted beyond
+* the calibrTolerance configuration parameter.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS          - The calibration data is valid.
+* * CY_CSDADC_CALIBRATION_FAIL - The recalibration failed.
+*
+*******************************************************************************/
+static cy_en_csdadc_status_t Cy_CSDADC_CheckCalibration(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+    uint32_t tmpResult;
+    uint32_t driftInRange;
+
+    /* Disconnect channels, configure IDAC, and set the busy status */
+    Cy_CSDADC_PrepareMeasurement(context);
+
+    /* Repeat the calibration phase 1 */
+    tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREF, context);
+    driftInRange = Cy_CSDADC_IsDriftInRange(tmpResult, (uint32_t)context->tVssa2Vref, context);
+
+    if ((0u != driftInRange) && (CY_CSDADC_RANGE_VDDA == context->cfgCopy.range))
+    {
+        /* Repeat the calibration phase 3 */
+        Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_CONNECT, context);
+        tmpResult = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VIN, context);
+        Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, context);
+        driftInRange = Cy_CSDADC_IsDriftInRange(tmpResult, (uint32_t)context->tVdda2VrefRaw, context);
+    }
+
+    if (0u == driftInRange)
+    {
+        /* The interrupt may be not routed to the CSDADC yet, so do not use Cy_CSDADC_Calibrate() */
+        result = Cy_CSDADC_CalibrateBlocking(context);
+    }
+
+    /* Set the idle status */
+    context->status = (uint16_t)CY_CSDADC_INIT_MASK;
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_CalibrateBlocking
+****************************************************************************//**
+*
+* Performs the calibration phases by polling the CSD HW block without
+* the CSDADC interrupt and updates the calibration data.
+*
+* The channels must be disconnected and IDAC configured by
+* the Cy_CSDADC_PrepareMeasurement() function before. The IDAC code is not
+* recalibrated.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS          - The calibration data is updated.
+* * CY_CSDADC_CALIBRATION_FAIL - A calibration phase failed. The calibration
+*                                data is not changed.
+*
+*******************************************************************************/
+static cy_en_csdadc_status_t Cy_CSDADC_CalibrateBlocking(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_CALIBRATION_FAIL;
+    uint32_t timeVssa2Vref;
+    uint32_t timeRecover = 0u;
+    uint32_t timeVdda2Vref = 0u;
+
+    /* Phase 1: charge Cref from Vssa to Vref */
+    timeVssa2Vref = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREF, context);
+    if ((CY_CSDADC_MEASUREMENT_FAILED != timeVssa2Vref) && (CY_CSDADC_RANGE_VDDA == context->cfgCopy.range))
+    {
+        /* Phase 2: recharge Cref to Vref after the discharge */
+        timeRecover = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VREFBY2, context);
+        if (CY_CSDADC_MEASUREMENT_FAILED != timeRecover)
+        {
+            /* Phase 3: discharge Cref from Vdda to Vref */
+            Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_CONNECT, context);
+            timeVdda2Vref = Cy_CSDADC_StartAndWait((uint32_t)CY_CSDADC_MEASMODE_VIN, context);
+            Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, context);
+        }
+    }
+
+    if ((CY_CSDADC_MEASUREMENT_FAILED != timeVssa2Vref) &&
+        (CY_CSDADC_MEASUREMENT_FAILED != timeRecover) &&
+        (CY_CSDADC_MEASUREMENT_FAILED != timeVdda2Vref) &&
+        (0u != (timeVssa2Vref & CY_CSDADC_ADC_RES_VALUE_MASK)))
+    {
+        Cy_CSDADC_SetCalibration(timeVssa2Vref & CY_CSDADC_ADC_RES_VALUE_MASK,
+                                 timeRecover & CY_CSDADC_ADC_RES_VALUE_MASK,
+                                 timeVdda2Vref & CY_CSDADC_ADC_RES_VALUE_MASK, context);
+        result = CY_CSDADC_SUCCESS;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ClearChannels
+****************************************************************************//**
+*
+* Resets all the CSDADC channels to disconnected state.
+*
+* The function goes through all the CSDADC channels and disconnects the pin
+* and the analog muxbus B. Also, sets the pin Drive mode to High-Z Analog,
+* so the channel switching does not need to update it.
+*
+*******************************************************************************/
+static void Cy_CSDADC_ClearChannels(cy_stc_csdadc_context_t * context)
+{
+    uint32_t chId;
+    uint32_t interruptState = Cy_SysLib_EnterCriticalSection();
+
+    for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+    {
+        Cy_CSDADC_SetAdcChannel(chId, CY_CSDADC_CHAN_DISCONNECT, context);
+        /* Update port configuration register (drive mode) to High-Z Analog */
+        Cy_GPIO_SetDrivemode(context->cfgCopy.ptrPinList[chId].ioPcPtr,
+                             (uint32_t)context->cfgCopy.ptrPinList[chId].pin, CY_GPIO_DM_ANALOG);
+    }
+    context->activeCh = CY_CSDADC_NO_CHANNEL;
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_DsInitialize
+****************************************************************************//**
+*
+* Initializes the CSDADC data structure.
+*
+* The function makes the following tasks:
+* * copies the configuration structure to the context
+* * clears the result arrays
+* * sets or calculates and trims Vref
+* * calculates Vref gain
+* * sets or calculates IDAC
+* * calculates snsClkDivider
+* * precalculates the reciprocals used to scale the conversion results
+*
+* \param config
+* The pointer to the CSDADC middleware configuration structure.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_DsInitialize(
+                const cy_stc_csdadc_config_t * config,
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t nMax;
+    uint32_t vMax;
+    uint32_t vRefDesired;
+    uint32_t iDacGain;
+    uint32_t chIndex;
+    uint32_t snsClkDiv;
+    uint32_t codeMaxIdac;
+    uint32_t vGain;
+
+    /* Clear the result structure */
+    for (chIndex = 0u; chIndex < CY_CSDADC_MAX_CHAN_NUM; chIndex++)
+    {
+            context->adcResult[chIndex].code = 0u;
+            context->adcResult[chIndex].mVolts = 0u;
+    }
+
+    /* Clear the ptrEOCCallback */
+    context->ptrEOCCallback = NULL;
+    /* Clear the timestamp function and the phase statistics */
+    context->ptrTimestamp = NULL;
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        (void)Cy_CSDADC_ResetPhaseStat(context);
+    #endif
+
+    /* Disable the streaming mode and the raw capture mode */
+    context->stream.ptrBuf = NULL;
+    context->raw.ptrBuf = NULL;
+
+    /* Disable the limit detection */
+    context->ptrLimit = NULL;
+
+    /* Disable the channel statistics and the extended results */
+    context->ptrStat = NULL;
+    context->ptrResultExt = NULL;
+
+    /* Disable the result frames */
+    context->ptrFrame = NULL;
+
+    /* Clear the request queue */
+    context->queue.pending = 0u;
+    context->queue.acquired = 0u;
+    context->queue.waitCnt = 0u;
+    context->queue.maxWaitCnt = 0u;
+    context->queue.grantCnt = 0u;
+    context->queue.deferCnt = 0u;
+
+    /* Convert every enabled channel in each cycle */
+    context->rateMask = 0u;
+    for (chIndex = 0u; chIndex < CY_CSDADC_MAX_CHAN_NUM; chIndex++)
+    {
+        context->chRateDiv[chIndex] = 1u;
+        context->chRateCnt[chIndex] = 0u;
+    }
+
+    /* The calibration data is not valid until the calibration */
+    context->calibrDone = 0u;
+    context->calibrPending = 0u;
+
+    /* Clear the oversampling accumulator */
+    CY_ASSERT_L3(CY_CSDADC_OVERSAMPLING_64X >= config->oversampling);
+    context->osSum = 0u;
+    context->osCnt = 0u;
+
+    /* Choose VrefDesired depending on configured Vref value */
+    if (0 > config->vref)
+    {
+        #if defined (CY_IP_MXCSDV2)
+            if (config->vdda < CY_CSDADC_VDDA_LIMITATION_2200)
+            {
+                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_1_16;
+            }
+            else if (config->vdda > CY_CSDADC_VDDA_LIMITATION_2750)
+            {
+                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_2_13;
+            }
+            else
+            {
+                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_1_60;
+            }
+        #elif defined(CY_IP_M0S8CSDV2)
+            if (config->vdda < CY_CSDADC_VDDA_LIMITATION_2733)
+            {
+                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_1_20;
+            }
+            else if (config->vdda > CY_CSDADC_VDDA_LIMITATION_4500)
+            {
+                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_3_84;
+            }
+            else
+            {
+                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_2_13;
+            }
+        #else
+            #error Unsupported platform
+        #endif
+    }
+    else
+    {
+        vRefDesired = (uint32_t)config->vref;
+        /* Check for Vref limitations */
+        if (vRefDesired > ((uint32_t)config->vdda - CY_CSDADC_VREF_VDDA_MIN_DIFF))
+        {
+            vRefDesired = ((uint32_t)config->vdda - CY_CSDADC_VREF_VDDA_MIN_DIFF);
+        }
+    }
+
+    /* Calculate Vref gain */
+    vGain = (((uint32_t)CY_CSDADC_VREF_GAIN_MAX * (uint32_t)CY_CSDADC_VREF_IN_SRSS) - 1u) / (vRefDesired + 1u);
+    if (vGain > ((uint32_t)CY_CSDADC_VREF_GAIN_MAX - 1u))
+    {
+        vGain = (uint32_t)CY_CSDADC_VREF_GAIN_MAX - 1u;
+    }
+    context->vRefGain = (uint8_t)vGain;
+
+    /* Calculate Vref with rounding and store in the context structure */
+    context->vRefMv = (uint16_t)((((uint32_t)CY_CSDADC_VREF_GAIN_MAX * CY_CSDADC_VREF_IN_SRSS) + ((vGain + 1u) >> 1u))
+                                                                                                    / (vGain + 1u));
+
+    /* Update nominal Vref to real Vref */
+    context->vRefMv = (uint16_t)Cy_CSD_GetVrefTrim((uint32_t)context->vRefMv);
+
+    /* Define Vmax depending on CSDADC range */
+    if (CY_CSDADC_RANGE_VREF == config->range)
+    {
+        vMax = context->vRefMv;
+        context->vMaxMv = (uint16_t)vMax;
+    }
+    else
+    /* For 0-Vdda range determine what voltage is more Vdda-Vref or Vref */
+    {
+        vMax = (((config->vdda - context->vRefMv) > context->vRefMv) ?
+                                                ((uint32_t)config->vdda - context->vRefMv) : (uint32_t)context->vRefMv);
+        /* The channels in the Vref range need the full resolution between Vssa and Vref */
+        if (0u != config->chRangeVref)
+        {
+            vMax = context->vRefMv;
+        }
+        context->vMaxMv = config->vdda;
+    }
+    /* Max CSDADC code for IDAC calculation depends on resolution and must be multiplied by 2 for accuracy */
+    if (CY_CSDADC_RESOLUTION_8BIT == config->resolution)
+    {
+        codeMaxIdac = CY_CSDADC_RES_8_PLUS_1_MAX_VAL;
+    }
+    else
+    {
+        codeMaxIdac = CY_CSDADC_RES_10_PLUS_1_MAX_VAL;
+    }
+
+    /* Depends on IDAC gain */
+    /* Calculate IDAC gain with an appropriate operation sequence to avoid overflow */
+    iDacGain = (config->periClk / codeMaxIdac) / config->operClkDivider;
+    iDacGain = (((iDacGain * vMax) / CY_CSDADC_MEGA) * CY_CSDADC_CREF) / CY_CSDADC_IDAC_LSB;
+    if (CY_CSDADC_IDAC_MAX < iDacGain)
+    {
+        iDacGain = CY_CSDADC_IDAC_MAX;
+    }
+    context->cfgCopy.idac = (uint8_t) iDacGain;
+    /* The phase 1 time of the calculated IDAC code is the target of the IDAC calibration */
+    context->idacTarget = (uint16_t)((codeMaxIdac * context->vRefMv) / vMax);
+    context->idacHigh = 0u;
+
+    /* Set init value for tVssa2Vref. It'll be corrected after calibration */
+    context->tVssa2Vref = (uint16_t)codeMaxIdac;
+    /* Set init value for tRecover. It'll be corrected after calibration */
+    context->tRecover = (uint16_t)codeMaxIdac;
+    /* Set init value for tVdda2Vref. It'll be corrected after calibration */
+    nMax = (uint32_t)context->tVssa2Vref * ((uint32_t)context->cfgCopy.vdda - context->vRefMv);
+    context->tVdda2Vref = (uint16_t)(nMax / context->vRefMv);
+    /* Set init value for tFull. It'll be corrected after calibration */
+    context->tFull = context->tVssa2Vref + context->tVdda2Vref;
+
+    /* Max CSDADC code depends on resolution */
+    if (CY_CSDADC_RESOLUTION_8BIT == config->resolution)
+    {
+        context->codeMax = (uint16_t)CY_CSDADC_RES_8_MAX_VAL;
+    }
+    else
+    {
+        context->codeMax = (uint16_t)CY_CSDADC_RES_10_MAX_VAL;
+    }
+    Cy_CSDADC_UpdateDivisors(context);
+
+    /* Calculate snsClkDivider as small as possible */
+    /* Choose the max time interval */
+    nMax = config->acqTime;
+    if (config->azTime > nMax)
+    {
+        nMax = config->azTime;
+    }
+    nMax = (nMax * (config->periClk / CY_CSDADC_MEGA)) / config->operClkDivider;
+    /* The smallest divider that gives (nMax / snsClkDiv) < CY_CSDADC_MAX_SNSCLK_CYCLES */
+    snsClkDiv = (nMax / CY_CSDADC_MAX_SNSCLK_CYCLES) + 1u;
+    if (snsClkDiv < CY_CSDADC_MIN_SNSCLK_DIVIDER)
+    {
+        snsClkDiv = CY_CSDADC_MIN_SNSCLK_DIVIDER;
+    }
+    if (snsClkDiv > CY_CSDADC_MAX_SNSCLK_DIVIDER)
+    {
+        snsClkDiv = CY_CSDADC_MAX_SNSCLK_DIVIDER;
+    }
+    context->acqCycles = (uint8_t)((config->acqTime * (config->periClk / CY_CSDADC_MEGA)) / config->operClkDivider / snsClkDiv);
+    context->azCycles = (uint8_t)((config->azTime * (config->periClk / CY_CSDADC_MEGA)) / config->operClkDivider / snsClkDiv);
+    context->snsClkDivider = (uint8_t)snsClkDiv;
+    /* Convert every channel with the configured acquisition time */
+    for (chIndex = 0u; chIndex < CY_CSDADC_MAX_CHAN_NUM; chIndex++)
+    {
+        context->chAcqCycles[chIndex] = context->acqCycles;
+    }
+
+    /* Set INIT done */
+    context->status |= (uint16_t)CY_CSDADC_INIT_DONE;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SetAdcChannel
+****************************************************************************//**
+*
+* Sets the given channel to the given state.
+*
+* Connects/disconnects the pin and the analog muxbus B. The drive mode
+* of the pin is set by Cy_CSDADC_ClearChannels(). The function must be called
+* inside a critical section.
+*
+* \param chId
+* The ID of the channel to be set.
+*
+* \param state
+* The state in which the channel is to be put:
+* * (0) CY_CSDADC_CHAN_DISCONNECT
+* * (1) CY_CSDADC_CHAN_CONNECT
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SetAdcChannel(
+                uint32_t chId,
+                uint32_t state,
+                const cy_stc_csdadc_context_t * context)
+{
+    cy_stc_csdadc_ch_pin_t const ptr2adcIO = context->cfgCopy.ptrPinList[chId];
+    switch (state)
+    {
+    case CY_CSDADC_CHAN_CONNECT:
+        /* Connect AMuxBusB to the selected port */
+        Cy_GPIO_SetHSIOM(ptr2adcIO.ioPcPtr, (uint32_t)ptr2adcIO.pin, HSIOM_SEL_AMUXB);
+        break;
+
+    /* Disconnection is a safe default state. Fall-through is intentional. */
+    case CY_CSDADC_CHAN_DISCONNECT:
+    default:
+        /* Disconnect AMuxBusB from the selected port */
+        Cy_GPIO_SetHSIOM(ptr2adcIO.ioPcPtr, (uint32_t)ptr2adcIO.pin, HSIOM_SEL_GPIO);
+        break;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SwitchAdcChannel
+****************************************************************************//**
+*
+* Switches the analog muxbus B from the active channel to the given one.
+*
+* Disconnects the active channel (if any) and connects the given channel
+* inside a single critical section. Does nothing if the given channel is
+* already connected.
+*
+* \param chId
+* The ID of the channel to be connected. CY_CSDADC_NO_CHANNEL - only
+* disconnect the active channel.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SwitchAdcChannel(
+                uint32_t chId,
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t interruptState;
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        uint32_t startTime = Cy_CSDADC_GetTimestamp(context);
+    #endif
+
+    if (chId != (uint32_t)context->activeCh)
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        if (CY_CSDADC_NO_CHANNEL != context->activeCh)
+        {
+            /* Disconnect the current input channel */
+            Cy_CSDADC_SetAdcChannel((uint32_t)context->activeCh, CY_CSDADC_CHAN_DISCONNECT, context);
+        }
+        if (CY_CSDADC_NO_CHANNEL != chId)
+        {
+            /* Connect the desired input channel */
+            Cy_CSDADC_SetAdcChannel(chId, CY_CSDADC_CHAN_CONNECT, context);
+        }
+        context->activeCh = (uint8_t)chId;
+        Cy_SysLib_ExitCriticalSection(interruptState);
+        #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+            Cy_CSDADC_UpdatePhaseStat(CY_CSDADC_PHASE_CH_SWITCH, Cy_CSDADC_GetTimestamp(context) - startTime, context);
+        #endif
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SetVddaSwitch
+****************************************************************************//**
+*
+* Connects VDDA to csdbusB instead of the analog muxbus B or restores
+* the analog muxbus B connection.
+*
+* \param state
+* The state of the VDDA connection:
+* * (0) CY_CSDADC_CHAN_DISCONNECT - reconnect the analog muxbus B
+* * (1) CY_CSDADC_CHAN_CONNECT - disconnect the analog muxbus B, connect VDDA
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SetVddaSwitch(
+                uint32_t state,
+                const cy_stc_csdadc_context_t * context)
+{
+    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
+    uint32_t interruptState;
+
+    if (CY_CSDADC_CHAN_CONNECT == state)
+    {
+        /* Disconnect amuxbusB, Connect VDDA to csdbusB */
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        ptrCsdBaseAdd->SW_BYP_SEL &= (uint32_t)(~CY_CSDADC_SW_BYP_DEFAULT);
+        Cy_SysLib_ExitCriticalSection(interruptState);
+        ptrCsdBaseAdd->SW_SHIELD_SEL = CY_CSDADC_SW_SHIELD_VDDA2CSDBUSB;
+    }
+    else
+    {
+        /* Reconnect amuxbusB, disconnect VDDA */
+        ptrCsdBaseAdd->SW_SHIELD_SEL = CY_CSDADC_SW_SHIELD_DEFAULT;
+        interruptState = Cy_SysLib_EnterCriticalSection();
+        ptrCsdBaseAdd->SW_BYP_SEL |= CY_CSDADC_SW_BYP_DEFAULT;
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_PrepareMeasurement
+****************************************************************************//**
+*
+* Prepares the CSD HW block for the VDDA or AMUX-B measurement.
+*
+* The function masks and clears the CSD HW block interrupts, disconnects
+* the input channel, configures IDAC, and sets the busy status.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_PrepareMeasurement(
+                cy_stc_csdadc_context_t * context)
+{
+    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
+
+    /* Set the busy bit of the CSDADC status byte */
+    context->status |= CY_CSDADC_STATUS_BUSY_MASK;
+
+    /* Mask all CSD HW block interrupts (disable all interrupts) */
+    ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
+
+    /* Clear all pending interrupts of the CSD HW block */
+    ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
+    (void)ptrCsdBaseAdd->INTR;
+
+    /* Disconnect channels if connected */
+    if (CY_CSDADC_NO_CHANNEL != context->activeCh)
+    {
+        /* Disconnect existing input channel */
+        Cy_CSDADC_ClearChannels(context);
+        context->activeCh = CY_CSDADC_NO_CHANNEL;
+    }
+
+    /* Configure IDAC */
+    ptrCsdBaseAdd->IDACB = CY_CSDADC_IDACB_CONFIG | context->cfgCopy.idac;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_CalcVdda
+****************************************************************************//**
+*
+* Calculates VDDA in millivolts from the three measurement phases.
+*
+* \param timeVssa2Vref
+* The time to charge Cref from Vssa to Vref (phase 1).
+*
+* \param timeRecover
+* The time to recharge Cref to Vref after the discharge (phase 2).
+*
+* \param timeVdda2Vref
+* The time to discharge Cref from Vdda to Vref (phase 3).
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* Returns VDDA in millivolts.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_CalcVdda(
+                uint32_t timeVssa2Vref,
+                uint32_t timeRecover,
+                uint32_t timeVdda2Vref,
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpTime;
+
+    /* Calibrate timeVdda2Vref with Sink/Source mismatch with rounding */
+    tmpTime = ((((timeVdda2Vref << 1u) * timeRecover) + (timeVssa2Vref >> 1u)) / timeVssa2Vref);
+
+    return (context->vRefMv + (((context->vRefMv * tmpTime) + (timeVssa2Vref >> 1u)) / timeVssa2Vref));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SetCalibration
+****************************************************************************//**
+*
+* Stores the calibration data calculated from the calibration phase results
+* in the context structure.
+*
+* In the Vref range, only the phase 1 result is used.
+*
+* \param timeVssa2Vref
+* The time to charge Cref from Vssa to Vref (phase 1).
+*
+* \param timeRecover
+* The time to recharge Cref to Vref after the discharge (phase 2).
+*
+* \param timeVdda2Vref
+* The time to discharge Cref from Vdda to Vref (phase 3).
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SetCalibration(
+                uint32_t timeVssa2Vref,
+                uint32_t timeRecover,
+                uint32_t timeVdda2Vref,
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t tmpTime;
+
+    context->tVssa2Vref = (uint16_t)timeVssa2Vref;
+    if (CY_CSDADC_RANGE_VREF == context->cfgCopy.range)
+    {
+        context->vMaxMv = context->vRefMv;
+        context->tFull = (uint16_t)timeVssa2Vref;
+    }
+    else
+    {
+        context->tRecover = (uint16_t)timeRecover;
+        context->tVdda2VrefRaw = (uint16_t)timeVdda2Vref;
+        /* Calibrate timeVdda2Vref with Sink/Source mismatch with rounding */
+        tmpTime = (uint16_t)((((timeVdda2Vref << 1u) * timeRecover) + (timeVssa2Vref >> 1u)) / timeVssa2Vref);
+        context->tVdda2Vref = (uint16_t)tmpTime;
+        context->tFull = (uint16_t)(timeVssa2Vref + tmpTime);
+        context->vMaxMv = (uint16_t)(context->vRefMv +
+                                    ((((uint32_t)context->vRefMv * tmpTime) + (timeVssa2Vref >> 1u)) / timeVssa2Vref));
+    }
+    context->calibrDone = 1u;
+    context->calibrPending = 0u;
+    Cy_CSDADC_UpdateDivisors(context);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_CalibrateIdac
+****************************************************************************//**
+*
+* Checks the phase 1 calibration time for a target and selects the next
+* IDAC code to measure.
+*
+* The IDAC code calculated from the nominal Cref and Peri Clock is kept if
+* the phase 1 time is within a factor of 2 of the target. Otherwise,
+* the function binary-searches the smallest IDAC code whose phase 1 time does
+* not exceed the target, so the full-scale time uses the most clock cycles
+* available to the configured resolution. The search state is kept in
+* the context between the phase 1 measurements.
+*
+* \param timeVssa2Vref
+* The measured time to charge Cref from Vssa to Vref (phase 1).
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* 1 - phase 1 should be repeated with the new IDAC code, 0 - the IDAC code
+* is calibrated.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_CalibrateIdac(
+                uint32_t timeVssa2Vref,
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t retVal = 0u;
+    uint32_t idac = context->cfgCopy.idac;
+    uint32_t target = context->idacTarget;
+
+    if ((0u != context->cfgCopy.idacCalibrationEn) &&
+        ((0u != context->idacHigh) ||
+         (timeVssa2Vref > (target << CY_CSDADC_IDAC_TARGET_SHIFT)) ||
+         (timeVssa2Vref < (target >> CY_CSDADC_IDAC_TARGET_SHIFT))))
+    {
+        if (0u == context->idacHigh)
+        {
+            /* The calculated IDAC code is out of range, start the search in the whole IDAC range */
+            context->idacLow = (uint8_t)CY_CSDADC_IDAC_MIN;
+            context->idacHigh = (uint8_t)CY_CSDADC_IDAC_MAX;
+        }
+        /* Narrow the range, the phase 1 time is inversely proportional to the IDAC code */
+        if (timeVssa2Vref > target)
+        {
+            context->idacLow = (uint8_t)(idac + 1u);
+        }
+        else
+        {
+            context->idacHigh = (uint8_t)idac;
+        }
+        if (context->idacLow < context->idacHigh)
+        {
+            idac = ((uint32_t)context->idacLow + context->idacHigh) >> 1u;
+        }
+        else
+        {
+            idac = context->idacHigh;
+        }
+
+        if (idac != context->cfgCopy.idac)
+        {
+            context->cfgCopy.idac = (uint8_t)idac;
+            context->cfgCopy.base->IDACB = CY_CSDADC_IDACB_CONFIG | idac;
+            retVal = 1u;
+        }
+        else
+        {
+            /* The search is complete */
+            context->idacHigh = 0u;
+        }
+    }
+
+    return (retVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ResumeConversion
+****************************************************************************//**
+*
+* Connects the channel stored in the conversion counter and continues
+* the conversion after the background calibration.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_ResumeConversion(
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t chId = (context->counter & CY_CSDADC_COUNTER_CHAN_MASK) >> CY_CSDADC_COUNTER_CHAN_POS;
+
+    Cy_CSDADC_SwitchAdcChannel(chId, context);
+    context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+    context->status |= (uint16_t)CY_CSDADC_STATUS_CONVERTING;
+    Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, context);
+}
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StartFSM
+****************************************************************************//**
+*
+* Starts the CSD state machine with correct parameters to initialize an ADC
+* conversion.
+*
+* \param measureMode
+* The FSM mode:
+* * (0) CY_CSDADC_MEASMODE_OFF
+* * (1) CY_CSDADC_MEASMODE_VREF
+* * (2) CY_CSDADC_MEASMODE_VREFBY2
+* * (3) CY_CSDADC_MEASMODE_VIN
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+*******************************************************************************/
+static void Cy_CSDADC_StartFSM(
+                uint32_t measureMode,
+                cy_stc_csdadc_context_t * context)
+{
+    uint32_t acqCycles = context->acqCycles;
+    uint32_t tmpStartVal;
+    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
+
+    /* The connected input channel is converted with its own acquisition time */
+    if (CY_CSDADC_NO_CHANNEL != context->activeCh)
+    {
+        acqCycles = context->chAcqCycles[context->activeCh];
+    }
+    tmpStartVal = (uint32_t)(measureMode << CY_CSDADC_ADC_CTL_MEAS_POS) | (acqCycles - 1u);
+
+    /* Set the mode and acquisition time */
+    ptrCsdBaseAdd->ADC_CTL = tmpStartVal;
+
+    if(CY_CSDADC_MEASMODE_OFF == measureMode)
+    {
+        tmpStartVal = CY_CSDADC_FSM_ABORT;
+    }
+    /* This setting is used for MEASMODE_VREF, MEASMODE_VREFBY2, and MEASMODE_VIN */
+    else
+    {
+        tmpStartVal = CY_CSDADC_FSM_AZ_SKIP_DEFAULT | CY_CSDADC_FSM_START;
+    }
+    /* Unmask ADC_RES interrupt (enable interrupt) */
+    ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_ADC_RES_MSK;
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        context->phaseStart = Cy_CSDADC_GetTimestamp(context);
+    #endif
+    /* Start CSD sequencer */
+    ptrCsdBaseAdd->SEQ_START = tmpStartVal;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StartAndWait
+****************************************************************************//**
+*
+* Starts the CSD state machine and waits until the conversion ends.
+*
+* Starts the CSD state machine with correct parameters to initialize an ADC
+* conversion and waits until the conversion ends. To prevent hanging,
+* a program watchdog is used.
+*
+* \param measureMode
+* The FSM mode:
+* * (1) CY_CSDADC_MEASMODE_VREF
+* * (2) CY_CSDADC_MEASMODE_VREFBY2
+* * (3) CY_CSDADC_MEASMODE_VIN
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the result of the conversion. If an overflow occurs
+* or the watchdog triggers, CY_CSDADC_MEASUREMENT_FAILED is returned.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_StartAndWait(
+                uint32_t measureMode,
+                const cy_stc_csdadc_context_t * context)
+{
+    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
+
+    uint32_t tmpStartVal = (uint32_t)(measureMode << CY_CSDADC_ADC_CTL_MEAS_POS) | ((uint32_t)context->acqCycles - 1u);
+    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
+    uint32_t tmpResult;
+
+    uint32_t watchdogAdcCounter = CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM;
+
+    /* start CSDADC conversion with desired the mode and acquisition time */
+    ptrCsdBaseAdd->ADC_CTL = tmpStartVal;
+    ptrCsdBaseAdd->SEQ_START = CY_CSDADC_FSM_AZ_SKIP_DEFAULT | CY_CSDADC_FSM_START;
+
+    /* Check for watchdog counter */
+    while ((0u == (ptrCsdBaseAdd->INTR & CY_CSDADC_CSD_INTR_MASK_ADC_RES_MSK)) &&  (0u != watchdogAdcCounter))
+    {
+        /* Wait until scan complete and decrement Watchdog Counter to prevent unending loop */
+        watchdogAdcCounter--;
+    }
+
+    /* Clear all pending interrupts of the CSD HW block */
+    ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
+    (void)ptrCsdBaseAdd->INTR;
+
+    if (0u != watchdogAdcCounter)
+    {
+        /* Read ADC result and check for ADC_ABORT or ADC_OVERFLOW flags */
+        tmpResult = ptrCsdBaseAdd->ADC_RES;
+        if (0u == (tmpResult & CY_CSDADC_ADC_RES_ABORT_MASK))
+        {
+            if (0u == (tmpResult & CY_CSDADC_ADC_RES_OVERFLOW_MASK))
+            {
+                tmpRetVal = tmpResult;
+            }
+        }
+    }
+    return (tmpRetVal);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StartConvert
+****************************************************************************//**
+*
+* Initiates an analog-to-digital conversion.
+*
+* Initializes the CSD HW block to perform an analog-to-digital conversion
+* on input channels specified by chMask.
+* This is a non-blocking function. It initiates a conversion only on the first
+* input channel and does not wait for the conversion to complete.
+* A conversion on subsequent channels is initiated by the interrupt service
+* routine of the CSDADC middleware. Therefore, the Cy_CSDADC_IsEndConversion()
+* function must be used to check the conversion status to ensure
+* the previously initiated conversion is complete prior to initiating
+* other tasks. These include: reading the ADC result, initiation of a new
+* conversion on the same or a different channel, or calibration or
+* stopping a CSDADC conversion.
+*
+* In Single-shot mode, the CSDADC middleware performs one conversion
+* on all channels specified by the chMask argument and stops.
+* The Cy_CSDADC_IsEndConversion() function returns the CY_CSDADC_SUCCESS status
+* after conversion on all channels completes. Otherwise, it returns the
+* CY_CSDADC_HW_BUSY state. To get information on the latest conversion,
+* use the Cy_CSDADC_GetConversionStatus() function.
+*
+* In Continuous mode, this function continuously initiates conversions
+* on channels specified by chMask (i.e. once a conversion is completed
+* on all channels specified by chMask, the CSDADC MW initiates a next set
+* of conversions). The Cy_CSDADC_IsEndConversion() function
+* always returns the CY_CSDADC_HW_BUSY status. To get information on the latest
+* conversion, use the Cy_CSDADC_GetConversionStatus() functions.
+
+* \param mode
+* The desired mode of conversion:
+* * CY_CSDADC_SINGLE_SHOT - Only one conversion cycle of all chosen channels.
+* * CY_CSDADC_CONTINUOUS - Continuous mode.
+*
+* \param chMask
+* The bit mask with set bits of specified channels to convert.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS         - A conversion is started.
+* * CY_CSDADC_HW_BUSY         - A conversion is not started. The previously
+*                               initiated conversion is in progress or
+*                               the CSD HW block is in use by another
+*                               application.
+* * CY_CSDADC_BAD_PARAM       - A conversion is not started. The invalid mode
+*                               value or chMask is 0 or the context
+*                               pointer is NULL.
+* * CY_CSDADC_NOT_INITIALIZED - CSDADC to be initialized by using the
+*                               Cy_CSDADC_Init() and Cy_CSDADC_Enable()
+*                               functions.
+*
+* \funcusage
+*
+* An example of the conversion executing in Single-shot mode:
+* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
+* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionSingleShot
+*
+* An example of the conversion executing in Continuous mode:
+* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
+* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionContinuous
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StartConvert(
+                cy_en_csdadc_conversion_mode_t mode,
+                uint32_t chMask,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+    uint8_t chId = 0u;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL == context) || ((mode != CY_CSDADC_SINGLE_SHOT) && (mode != CY_CSDADC_CONTINUOUS)) ||
+            (chMask == 0u) || (chMask > ((uint32_t)(0x01uL << context->cfgCopy.numChannels) - 1u)))
+    {
+        result = CY_CSDADC_BAD_PARAM;
+    }
+    else
+    {
+        /* Check whether the CSDADC is configured */
+        if ((uint16_t)CY_CSDADC_INIT_DONE != (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
+        {
+            result = CY_CSDADC_NOT_INITIALIZED;
+        }
+        else
+        {
+            if(CY_CSDADC_SUCCESS != Cy_CSDADC_IsEndConversion(context))
+            {
+                result = CY_CSDADC_HW_BUSY;
+            }
+            else
+            {
+                /* Save chMask to the context structure */
+                context->chMask = chMask;
+                /* Set the conversion mode bits of the CSDADC status byte */
+                context->status &= (uint16_t)~(uint16_t)CY_CSDADC_CONV_MODE_MASK;
+                context->status |= (uint16_t)(((uint32_t)mode) << CY_CSDADC_CONV_MODE_BIT_POS);
+
+                /* Schedule all enabled channels in the first cycle */
+                for (chId = 0u; chId < CY_CSDADC_MAX_CHAN_NUM; chId++)
+                {
+                    context->chRateCnt[chId] = 0u;
+                }
+                (void)Cy_CSDADC_ScheduleCycle(context);
+
+                /* Choose the first desired channel to convert */
+                chId = Cy_CSDADC_GetNextCh(0u, context);
+                /* Configure a desired channel if needed */
+                Cy_CSDADC_SwitchAdcChannel((uint32_t)chId, context);
+
+                /* Set the cycle counter to zero and the number of the first channel to convert to the conversion counter */
+                context->counter = (uint32_t)(((uint32_t)chId) << CY_CSDADC_COUNTER_CHAN_POS);
+                /* Clear the oversampling accumulator */
+                context->osSum = 0u;
+                context->osCnt = 0u;
+                /* Restart the background calibration interval, the imported calibration data is refreshed after the first cycle
+                 * unless the raw capture mode is enabled */
+                context->calibrCnt = ((0u != context->calibrPending) && (NULL == context->raw.ptrBuf)) ?
+                                                                    1u : context->cfgCopy.calibrInterval;
+                /* Discard the results of an aborted cycle from the back frame */
+                if (NULL != context->ptrFrame)
+                {
+                    context->ptrFrame[context->frameWrite].chMask = 0u;
+                }
+                /* Clear stop bits */
+                context->status &= (uint16_t)~CY_CSDADC_STOP_BITS_MASK;
+                /* Set the busy bit of the CSDADC status byte */
+                context->status |= CY_CSDADC_STATUS_BUSY_MASK;
+                /* Set CSDADC FSM status */
+                context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+                context->status |= (uint16_t)CY_CSDADC_STATUS_CONVERTING;
+                /* Start conversion */
+                Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, context);
+            }
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_StopConvert
+****************************************************************************//**
+*
+* The function stops conversions in Continuous mode.
+*
+* This function can be used to stop CSDADC conversions in Continuous mode.
+* The ADC can be stopped instantly by ignoring current and all future
+* conversions in the queue. Or it can be stopped after the current conversion on
+* an input channel is completed but future conversions in the queue are ignored.
+* Or it can be stopped after the current conversion cycle (i.e. one set of
+* conversion on all enabled inputs) is completed and conversion
+* cycles in the queue are ignored.
+*
+* Check the ADC status using the Cy_CSDADC_IsEndConversion() function.
+* Start a new conversion or calibration only if the CSDADC is not busy.
+*
+* \param stopMode
+* The desired mode of the stop operation. It can be:
+* * CY_CSDADC_IMMED_STOP        - The CSDADC conversion will be stopped
+*                                 immediately. A last channel conversion
+*                                 may produce an invalid result.
+* * CY_CSDADC_CURRENT_CHAN_STOP - The CSDADC conversion will be stopped after
+*                                 the current channel conversion to be completed.
+* * CY_CSDADC_ENABLED_CHAN_STOP - The CSDADC conversion will be stopped after
+*                                 all the enabled channels conversions to be
+*                                 completed.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the next statuses:
+* * CY_CSDADC_SUCCESS   - The operation stopped successfully. The CSDADC conversion
+                          is stopped in the case of immediate Stop mode or
+                          the stop conversion bit in the CSDADC status byte is
+                          set to stop conversions after the current channel or
+                          all the enabled channels are completed.
+* * CY_CSDADC_BAD_PARAM - The input parameter is invalid.
+* * CY_CSDADC_TIMEOUT   - The CSD HW block did not stop within the expected
+*                         time frame.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_StopConvert(
+                cy_en_csdadc_stop_mode_t stopMode,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+    CSD_Type * ptrCsdBaseAdd;
+    uint32_t watchdogAdcCounter;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL == context) || ((CY_CSDADC_IMMED_STOP != stopMode) &&
+                            (CY_CSDADC_CURRENT_CHAN_STOP != stopMode) &&
+                            (CY_CSDADC_ENABLED_CHAN_STOP != stopMode)))
+    {
+        result = CY_CSDADC_BAD_PARAM;
+    }
+    else
+    {
+        if (CY_CSDADC_IMMED_STOP == stopMode)
+        {
+            ptrCsdBaseAdd = context->cfgCopy.base;
+
+            /* Mask all CSD HW block interrupts (disable all interrupts) */
+            ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
+
+            /* Stop the CSD HW block sequencer */
+            ptrCsdBaseAdd->SEQ_START = CY_CSDADC_FSM_ABORT;
+
+            /* Initialize Watchdog Counter with a time interval that is enough for the ADC operation to complete */
+            watchdogAdcCounter = CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM;
+            while ((CY_CSD_SUCCESS != Cy_CSD_GetConversionStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
+                                                                                     &&  (0u != watchdogAdcCounter))
+            {
+                /* Wait until scan complete and decrement Watchdog Counter to prevent unending loop */
+                watchdogAdcCounter--;
+            }
+
+            /* Clear all pending interrupts of the CSD HW block */
+            ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
+            (void)ptrCsdBaseAdd->INTR;
+
+            /* Reconnect amuxbusB if the conversion is stopped in the background calibration phase 3 */
+            Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, context);
+
+            if (0u == watchdogAdcCounter)
+            {
+                result = CY_CSDADC_TIMEOUT;
+            }
+            /* Clear all status bits except the initialization bit */
+            context->status &= (uint16_t)CY_CSDADC_INIT_MASK;
+
+        }
+        else if (CY_CSDADC_CURRENT_CHAN_STOP == stopMode)
+        {
+            context->status &= (uint16_t)~(CY_CSDADC_STOP_BITS_MASK);
+            context->status |= (uint16_t)(((uint32_t)CY_CSDADC_CURRENT_CHAN_STOP) << CY_CSDADC_STOP_BITS_POS);
+        }
+        else
+        {
+            context->status &= (uint16_t)~(CY_CSDADC_STOP_BITS_MASK);
+            context->status |= (uint16_t)(((uint32_t)CY_CSDADC_ENABLED_CHAN_STOP) << CY_CSDADC_STOP_BITS_POS);
+        }
+    }
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_QueueConvert
+****************************************************************************//**
+*
+* Queues a conversion request that is started once the CSD HW block is
+* available.
+*
+* Unlike the Cy_CSDADC_StartConvert() function, this function does not fail
+* if the CSD HW block is used by another middleware (e.g. CAPSENSE&trade;).
+* The request is kept in the context structure and started by
+* the Cy_CSDADC_ProcessQueue() function, which the application calls
+* periodically, e.g. once per main loop iteration. The CSD HW block is
+* captured by the Cy_CSDADC_Restore() function when it is free and is
+* released by the Cy_CSDADC_Save() function once the conversion completes,
+* so the other middleware gets the block in the time slots between the
+* CSDADC conversions. The function calls Cy_CSDADC_ProcessQueue() itself,
+* so the request may be started immediately.
+*
+* The queued conversion is started without returning to the application
+* after the CSD HW block is captured, so the application cannot switch
+* the CSD interrupt vector to Cy_CSDADC_InterruptHandler() in between. When
+* the CSD HW block is shared with other middleware, the application
+* interrupt handler of the CSD HW block must call the handler of the
+* middleware that holds the block according to Cy_CSD_GetLockStatus(), i.e.
+* Cy_CSDADC_InterruptHandler() for CY_CSD_ADC_KEY.
+*
+* Only one request can be pending at a time.
+*
+* \param mode
+* The desired mode of conversion, refer to Cy_CSDADC_StartConvert().
+*
+* \param chMask
+* The bit mask with set bits of specified channels to convert.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The request is queued or started.
+* * CY_CSDADC_BAD_PARAM   - An input parameter is invalid.
+* * CY_CSDADC_HW_BUSY     - Another request is pending.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_QueueConvert(
+                cy_en_csdadc_conversion_mode_t mode,
+                uint32_t chMask,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != context) && ((mode == CY_CSDADC_SINGLE_SHOT) || (mode == CY_CSDADC_CONTINUOUS)) &&
+            (chMask != 0u) && (chMask <= CY_CSDADC_CH_MASK_ALL(context->cfgCopy.numChannels)))
+    {
+        if (0u != context->queue.pending)
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            context->queue.mode = mode;
+            context->queue.chMask = chMask;
+            context->queue.waitCnt = 0u;
+            context->queue.pending = 1u;
+            (void)Cy_CSDADC_ProcessQueue(context);
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ProcessQueue
+****************************************************************************//**
+*
+* Arbitrates the CSD HW block for the request queued by
+* the Cy_CSDADC_QueueConvert() function.
+*
+* The function checks the CSD HW block lock key by Cy_CSD_GetLockStatus():
+* * If the block is free, it is captured by Cy_CSDADC_Restore() and
+*   the pending request is started.
+* * If the block is captured by the CSDADC, the pending request is started
+*   as soon as the previous conversion completes.
+* * If the block is captured by another middleware, the request is deferred
+*   and the deferral is counted in the \ref cy_stc_csdadc_queue_t structure.
+*
+* If no request is pending and the conversion started by this function
+* completes, the CSD HW block is released by Cy_CSDADC_Save().
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS     - The request is started or no request is pending.
+* * CY_CSDADC_BAD_PARAM   - The context pointer is NULL.
+* * CY_CSDADC_HW_BUSY     - The request is pending because the previous
+*                           conversion is in progress.
+* * CY_CSDADC_HW_LOCKED   - The request is pending because the CSD HW block
+*                           is used by another middleware.
+* * Other                 - The status of Cy_CSDADC_Restore() if it fails.
+*                           The request is pending. If the CSD HW block is
+*                           captured, the request is started by the next
+*                           call and the block is released as usual.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_ProcessQueue(
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    cy_en_csd_key_t mvKey;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        result = CY_CSDADC_SUCCESS;
+        mvKey = Cy_CSD_GetLockStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr);
+
+        if (0u != context->queue.pending)
+        {
+            if (CY_CSD_NONE_KEY == mvKey)
+            {
+                /* Capture the CSD HW block */
+                result = Cy_CSDADC_Restore(context);
+                /* Restore may fail after the block is captured, release it later in any case */
+                mvKey = Cy_CSD_GetLockStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr);
+                if (CY_CSD_ADC_KEY == mvKey)
+                {
+                    context->queue.acquired = 1u;
+                }
+            }
+
+            if (CY_CSD_ADC_KEY == mvKey)
+            {
+                if (CY_CSDADC_SUCCESS == result)
+                {
+                    result = Cy_CSDADC_StartConvert(context->queue.mode, context->queue.chMask, context);
+                }
+                if (CY_CSDADC_SUCCESS == result)
+                {
+                    context->queue.pending = 0u;
+                    context->queue.grantCnt++;
+                    if (context->queue.maxWaitCnt < context->queue.waitCnt)
+                    {
+                        context->queue.maxWaitCnt = context->queue.waitCnt;
+                    }
+                }
+            }
+            else
+            {
+                /* The CSD HW block is used by another middleware */
+                context->queue.deferCnt++;
+                if (CY_CSDADC_MAX_WAIT_CNT > context->queue.waitCnt)
+                {
+                    context->queue.waitCnt++;
+                }
+                result = CY_CSDADC_HW_LOCKED;
+            }
+        }
+        else if (0u != context->queue.acquired)
+        {
+            if (CY_CSDADC_SUCCESS == Cy_CSDADC_IsEndConversion(context))
+            {
+                /* Release the CSD HW block for other middleware */
+                (void)Cy_CSDADC_Save(context);
+                context->queue.acquired = 0u;
+            }
+        }
+        else
+        {
+            /* Nothing to do */
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_IsEndConversion
+****************************************************************************//**
+*
+* The function returns the status of the CSDADC's operation.
+*
+* This function is used to ensure that the CSDADC is in the idle state prior
+* to initiating a conversion, calibration, or configuration change.
+* Initiating any ADC operation while the CSDADC is in the busy state may
+* produce unexpected results from the ADC.
+*
+* \param context
+* The pointer to the CSDADC context.
+*
+* \return
+* The function returns the status of the ADC operation.
+* * CY_CSDADC_SUCCESS   - The ADC is not busy, so
+*                         a new conversion can be initiated.
+* * CY_CSDADC_BAD_PARAM - A conversion is not started. The invalid mode
+*                         value or chMask is 0 or the context
+*                         pointer is NULL.
+* * CY_CSDADC_HW_BUSY   - The previously initiated conversion is in progress.
+* * CY_CSDADC_OVERFLOW  - The most recent conversion caused an overflow. The root
+*                         cause of the overflow may be the previous calibration
+*                         values being invalid or the VDDA value is incorrect.
+*                         Perform re-calibration or set the appropriate VDDA
+*                         value to avoid this error condition.
+*
+* \funcusage
+*
+* An example of the Cy_CSDADC_IsEndConversion() function usage:
+* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
+* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionSingleShot
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_IsEndConversion(
+                const cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+    CSD_Type * ptrCsdBaseAdd;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL == context)
+    {
+        result = CY_CSDADC_BAD_PARAM;
+    }
+    else
+    {
+        ptrCsdBaseAdd = context->cfgCopy.base;
+
+        if (0u != (ptrCsdBaseAdd->ADC_RES & CY_CSDADC_ADC_RES_OVERFLOW_MASK))
+        {
+            result = CY_CSDADC_OVERFLOW;
+        }
+        else if (0u != (CY_CSDADC_STATUS_BUSY_MASK & context->status))
+        {
+           result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            /* Does nothing; result = CY_CSDADC_SUCCESS */
+        }
+    }
+    return result;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetConversionStatus
+****************************************************************************//**
+*
+* The function returns a current CSDADC conversion status.
+*
+* In Continuous mode, this function returns a combination of the current channel
+* number and current cycle number. This function can be used to identify whether
+* a cycle of conversion completed or identify the latest input where
+* the conversion completed so a result can be read.
+* In Single-shot mode, only the latest input where a conversion completed is returned.
+* A conversion cycle number is incremented by the CSDADC after each cycle
+* of conversion completes. The cycles skipped by the channel rate dividers
+* are counted as well, refer to Cy_CSDADC_SetChannelRate().
+* A channel number is assigned to each input channel.
+* A new start-conversion request resets the conversion cycle number to zero and
+* the channel number to the first enabled channel in the chMask parameter.
+*
+* \param context
+* The pointer to the CSDADC context.
+*
+* \return
+* The function returns a combination of the conversion number and channel number.
+* * Bit[0-26]  The current cycle number in Continuous mode. In the single
+*              shot mode, it is equal to 0u.
+* * Bit[27-31] A current input channel number inside the current cycle.
+* * If the context parameter is equal to NULL, then the function
+*   returns \ref CY_CSDADC_COUNTER_BAD_PARAM.
+*
+* \funcusage
+*
+* An example of the Cy_CSDADC_GetConversionStatus() function usage:
+* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
+* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionContinuous
+*
+*******************************************************************************/
+uint32_t Cy_CSDADC_GetConversionStatus(const cy_stc_csdadc_context_t * context)
+{
+    uint32_t result = CY_CSDADC_COUNTER_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context)
+    {
+        result = context->counter;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_Calibrate
+****************************************************************************//**
+*
+* Performs calibration of the CSDADC.
+*
+* Executes calibration for the CSDADC to identify optimal CSD HW block
+* configuration to produce accurate results. The configuration parameters
+* are dependent on VDDA, VREF, IDAC, and PERI_CLK tolerances, and hence
+* run calibrations periodically (for example every 10 seconds)
+* to compensate for variation in the above mentioned parameters.
+*
+* The IDAC code is calculated from the nominal Cref and Peri Clock. If
+* the idacCalibrationEn field of the \ref cy_stc_csdadc_config_t structure
+* is set and the time to charge Cref to Vref differs from the target for
+* the configured resolution by more than a factor of 2, the calibration
+* binary-searches the IDAC code that brings the time to the target.
+* The search repeats the first calibration phase up to 8 times. The background
+* calibration keeps the IDAC code.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS          - The CSD HW block is successfully calibrated for
+*                                the ADC use.
+* * CY_CSDADC_BAD_PARAM        - The context pointer is NULL. Calibration has not
+*                                been executed.
+* * CY_CSDADC_HW_BUSY          - The CSD HW block is already in use by the previously
+*                                initialized conversion or another function.
+*                                Calibration has not been executed.
+* * CY_CSDADC_CALIBRATION_FAIL - The operation watchdog is triggered.
+*                                The calibration was not performed.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_Calibrate(cy_stc_csdadc_context_t * context)
+{
+    uint32_t watchdogAdcCounter;
+    CSD_Type * ptrCsdBaseAdd;
+
+    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL == context)
+    {
+        result = CY_CSDADC_BAD_PARAM;
+    }
+    else
+    {
+        if (CY_CSD_SUCCESS != Cy_CSD_GetConversionStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else
+        {
+            /* Disconnect channels if connected */
+            if (CY_CSDADC_NO_CHANNEL != context->activeCh)
+            {
+                /* Disconnect existing input channel */
+                Cy_CSDADC_ClearChannels(context);
+                context->activeCh = CY_CSDADC_NO_CHANNEL;
+            }
+
+            ptrCsdBaseAdd = context->cfgCopy.base;
+            ptrCsdBaseAdd->IDACB = CY_CSDADC_IDACB_CONFIG | context->cfgCopy.idac;
+            /* Start the IDAC calibration from the current code */
+            context->idacHigh = 0u;
+
+            /* Set the busy bit of the CSDADC status byte */
+            context->status |= (uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
+            /* Set CADADC FSM status */
+            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+            context->status |= (uint16_t)CY_CSDADC_STATUS_CALIBPH1;
+            /* Un-mask ADC_RES interrupt (enable interrupt) */
+            Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VREF, context);
+
+            /* Initialize Watchdog Counter with a time interval that is enough for ADC calibration to complete */
+            watchdogAdcCounter = CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM;
+            if (0u != context->cfgCopy.idacCalibrationEn)
+            {
+                /* Phase 1 is repeated during the IDAC calibration */
+                watchdogAdcCounter *= CY_CSDADC_IDAC_CALIBR_STEPS;
+            }
+            while (((context->status & CY_CSDADC_STATUS_FSM_MASK) != 0u) &&  (0u != watchdogAdcCounter))
+            {
+                /* Wait until scan complete and decrement Watchdog Counter to prevent unending loop */
+                watchdogAdcCounter--;
+            }
+            if (0u == watchdogAdcCounter)
+            {
+                result = CY_CSDADC_CALIBRATION_FAIL;
+            }
+        }
+    }
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ExportCalibration
+****************************************************************************//**
+*
+* Exports the calibration data of the CSDADC.
+*
+* The function copies the current calibration data and the configuration
+* parameters the data is bound to into the calibration data structure and
+* protects it with the version and the CRC. The application can store
+* the structure in non-volatile memory and pass it to
+* the Cy_CSDADC_EnableWarm() or Cy_CSDADC_ImportCalibration() function
+* after the next reset to skip the blocking calibration.
+*
+* The function can be called at any time. The calibration data is copied in
+* the critical section, so the exported data is consistent even if
+* the background calibration updates it during the Continuous mode.
+*
+* \param calibrData
+* The pointer to the calibration data structure to be filled.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS          - The calibration data is exported.
+* * CY_CSDADC_BAD_PARAM        - The input pointer is NULL.
+* * CY_CSDADC_NOT_INITIALIZED  - The CSDADC is not initialized.
+* * CY_CSDADC_CALIBRATION_FAIL - The CSDADC is not calibrated.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_ExportCalibration(
+                cy_stc_csdadc_calibr_data_t * calibrData,
+                const cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != calibrData);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != calibrData) && (NULL != context))
+    {
+        if (CY_CSDADC_INIT_DONE != (context->status & CY_CSDADC_INIT_MASK))
+        {
+            result = CY_CSDADC_NOT_INITIALIZED;
+        }
+        else if (0u == context->calibrDone)
+        {
+            result = CY_CSDADC_CALIBRATION_FAIL;
+        }
+        else
+        {
+            /* Take a snapshot that the background calibration cannot tear */
+            interruptState = Cy_SysLib_EnterCriticalSection();
+            calibrData->periClk = context->cfgCopy.periClk;
+            calibrData->version = (uint16_t)CY_CSDADC_CALIBR_DATA_VERSION;
+            calibrData->tVssa2Vref = context->tVssa2Vref;
+            calibrData->tRecover = context->tRecover;
+            calibrData->tVdda2Vref = context->tVdda2Vref;
+            calibrData->tVdda2VrefRaw = context->tVdda2VrefRaw;
+            calibrData->tFull = context->tFull;
+            calibrData->vMaxMv = context->vMaxMv;
+            calibrData->vRefMv = context->vRefMv;
+            calibrData->vdda = context->cfgCopy.vdda;
+            calibrData->idac = context->cfgCopy.idac;
+            calibrData->vRefGain = context->vRefGain;
+            calibrData->operClkDivider = context->cfgCopy.operClkDivider;
+            calibrData->range = (uint8_t)context->cfgCopy.range;
+            calibrData->resolution = (uint8_t)context->cfgCopy.resolution;
+            calibrData->rangeVref = (0u != context->cfgCopy.chRangeVref) ? 1u : 0u;
+            Cy_SysLib_ExitCriticalSection(interruptState);
+            calibrData->reserved[0u] = 0u;
+            calibrData->reserved[1u] = 0u;
+            calibrData->crc = Cy_CSDADC_CalcCrc((const uint8_t *)calibrData,
+                                                (uint32_t)offsetof(cy_stc_csdadc_calibr_data_t, crc));
+            result = CY_CSDADC_SUCCESS;
+        }
+    }
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_ImportCalibration
+****************************************************************************//**
+*
+* Imports the calibration data of the CSDADC.
+*
+* The function verifies the version and the CRC of the calibration data
+* exported by the Cy_CSDADC_ExportCalibration() function and whether
+* the data was obtained with the current Peri Clock, Vref, Vdda, range,
+* resolution, operation clock divider, and IDAC sizing of the chRangeVref
+* configuration parameter. If the data is valid, the function applies
+* it instead of the calibration. The imported data does not compensate
+* the VDDA, VREF, IDAC, and PERI_CLK drift since the export, so refresh it by
+* the Cy_CSDADC_Calibrate() function or the background calibration.
+*
+* The imported IDAC code is applied to the CSD HW block immediately if
+* the block is captured by the CSDADC. Otherwise, it is applied by
+* the next Cy_CSDADC_Restore() function call.
+*
+* \param calibrData
+* The pointer to the stored calibration data.
+*
+* \param context
+* The pointer to the CSDADC context structure.
+*
+* \return
+* The function returns the status of its operation.
+* * CY_CSDADC_SUCCESS         - The calibration data is imported.
+* * CY_CSDADC_BAD_PARAM       - The input pointer is NULL or the calibration
+*                               data is corrupted or does not match
+*                               the current configuration.
+* * CY_CSDADC_NOT_INITIALIZED - The CSDADC is not initialized.
+* * CY_CSDADC_HW_BUSY         - A conversion is in progress.
+*
+*******************************************************************************/
+cy_en_csdadc_status_t Cy_CSDADC_ImportCalibration(
+                const cy_stc_csdadc_calibr_data_t * calibrData,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_en_csdadc_status_t result = CY_CSDADC_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != calibrData);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != calibrData) && (NULL != context))
+    {
+        if (CY_CSDADC_INIT_DONE != (context->status & CY_CSDADC_INIT_MASK))
+        {
+            result = CY_CSDADC_NOT_INITIALIZED;
+        }
+        else if (0u != (context->status & CY_CSDADC_STATUS_BUSY_MASK))
+        {
+            result = CY_CSDADC_HW_BUSY;
+        }
+        else if (((uint16_t)CY_CSDADC_CALIBR_DATA_VERSION == calibrData->version) &&
+                 (Cy_CSDADC_CalcCrc((const uint8_t *)calibrData,
+                        (uint32_t)offsetof(cy_stc_csdadc_calibr_data_t, crc)) == calibrData->crc) &&
+                 (0u != calibrData->tVssa2Vref) &&
+                 (0u != calibrData->tFull) &&
+                 (context->cfgCopy.periClk == calibrData->periClk) &&
+                 (context->vRefMv == calibrData->vRefMv) &&
+                 (context->cfgCopy.vdda == calibrData->vdda) &&
+                 (context->vRefGain == calibrData->vRefGain) &&
+                 (context->cfgCopy.operClkDivider == calibrData->operClkDivider) &&
+                 ((uint8_t)context->cfgCopy.range == calibrData->range) &&
+                 ((uint8_t)context->cfgCopy.resolution == calibrData->resolution) &&
+                 (((0u != context->cfgCopy.chRangeVref) ? 1u : 0u) == calibrData->rangeVref))
+        {
+            context->tVssa2Vref = calibrData->tVssa2Vref;
+            context->tRecover = calibrData->tRecover;
+            context->tVdda2Vref = calibrData->tVdda2Vref;
+            context->tVdda2VrefRaw = calibrData->tVdda2VrefRaw;
+            context->tFull = calibrData->tFull;
+            context->vMaxMv = calibrData->vMaxMv;
+            context->cfgCopy.idac = calibrData->idac;
+            context->calibrDone = 1u;
+            Cy_CSDADC_UpdateDivisors(context);
+            /* The timings are valid only with the imported IDAC code */
+            if (CY_CSD_ADC_KEY == Cy_CSD_GetLockStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
+            {
+                context->cfgCopy.base->IDACB = CY_CSDADC_IDACB_CONFIG | (uint32_t)context->cfgCopy.idac;
+            }
+            result = CY_CSDADC_SUCCESS;
+        }
+        else
+        {
+            /* The calibration data is rejected */
+        }
+    }
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetNextCh
+****************************************************************************//**
+*
+* Get the next channel scheduled in the current cycle starting from the current.
+*
+* The function checks whether the current channel is set in the cycleMask.
+* If the current channel is set in cycleMask, the function returns
+* the current number. If not, the function seeks the next scheduled channel.
+* If the current channel and all the next are not scheduled, the function
+* returns the channel's number.
+*
+* The next channel is found in constant time as the count of trailing zeros
+* of the remaining-channel mask.
+*
+* \param currChId
+* The ID of the channel to start the enabled checking.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The function returns the next enabled channel number starting from
+* the current one.
+*
+*******************************************************************************/
+static uint8_t Cy_CSDADC_GetNextCh(
+                uint8_t currChId,
+                const cy_stc_csdadc_context_t * context)
+{
+    uint8_t chId = context->cfgCopy.numChannels;
+    uint32_t remainMask = 0u;
+
+    #if (0u == CY_CSDADC_CTZ_HW_EN)
+        static const uint8_t ctzTable[CY_CSDADC_MAX_CHAN_NUM] =
+        {
+            0u,  1u,  28u, 2u,  29u, 14u, 24u, 3u,  30u, 22u, 20u, 15u, 25u, 17u, 4u,  8u,
+            31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u,  26u, 12u, 18u, 6u,  11u, 5u,  10u, 9u
+        };
+    #endif
+
+    /* Get the mask of the enabled channels starting from the current one */
+    if (currChId < chId)
+    {
+        remainMask = context->cycleMask & ((uint32_t)~((1uL << currChId) - 1u));
+        if (chId < CY_CSDADC_MAX_CHAN_NUM)
+        {
+            remainMask &= (uint32_t)((1uL << chId) - 1u);
+        }
     }
-    context->activeCh = CY_CSDADC_NO_CHANNEL;
+    else
+    {
+        chId = currChId;
+    }
+
+    /* Choose the first set channel to convert */
+    if (0u != remainMask)
+    {
+        #if (0u != CY_CSDADC_CTZ_HW_EN)
+            chId = (uint8_t)__CLZ(__RBIT(remainMask));
+        #else
+            remainMask = (uint32_t)((remainMask & (0u - remainMask)) * CY_CSDADC_CTZ_DEBRUIJN);
+            chId = ctzTable[remainMask >> CY_CSDADC_CTZ_DEBRUIJN_SHIFT];
+        #endif
+    }
+
+    return (chId);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_DsInitialize
+* Function Name: Cy_CSDADC_ScheduleCycle
 ****************************************************************************//**
 *
-* Initializes the CSDADC data structure.
-*
-* The function makes the following tasks:
-* * copies the configuration structure to the context
-* * clears the result arrays
-* * sets or calculates and trims Vref
-* * calculates Vref gain
-* * sets or calculates IDAC
-* * calculates snsClkDivider
+* Selects the channels to convert in the next enabled channel cycle.
 *
-* \param config
-* The pointer to the CSDADC middleware configuration structure.
+* A channel enabled in chMask is scheduled once per its rate divider cycles.
+* If no channel is due in the next cycle, the channel counters are advanced
+* to the nearest cycle where at least one channel is due, so the CSD HW block
+* never runs an empty cycle. If no enabled channel has a rate divider greater
+* than 1, all enabled channels are scheduled without scanning the counters.
 *
 * \param context
 * The pointer to the CSDADC middleware context structure.
 *
+* \return
+* The number of skipped cycles.
+*
 *******************************************************************************/
-static void Cy_CSDADC_DsInitialize(
-                const cy_stc_csdadc_config_t * config,
+static uint32_t Cy_CSDADC_ScheduleCycle(
                 cy_stc_csdadc_context_t * context)
 {
-    uint32_t nMax;
-    uint32_t vMax;
-    uint32_t vRefDesired;
-    uint32_t iDacGain;
-    uint32_t chIndex;
-    uint32_t snsClkDiv = CY_CSDADC_MIN_SNSCLK_DIVIDER;
-    uint32_t codeMaxIdac;
-    uint32_t vGain;
+    uint32_t chId;
+    uint32_t chBit;
+    uint32_t skipNum = CY_CSDADC_RATE_DIV_MAX;
+    uint32_t cycleMask = 0u;
 
-    /* Clear the result structure */
-    for (chIndex = 0u; chIndex < CY_CSDADC_MAX_CHAN_NUM; chIndex++)
+    if (0u == (context->chMask & context->rateMask))
     {
-            context->adcResult[chIndex].code = 0u;
-            context->adcResult[chIndex].mVolts = 0u;
+        /* Every enabled channel is due in each cycle if no rate divider is used */
+        skipNum = 0u;
+        cycleMask = context->chMask;
     }
-
-    /* Clear the ptrEOCCallback */
-    context->ptrEOCCallback = NULL;
-
-    /* Choose VrefDesired depending on configured Vref value */
-    if (0 > config->vref)
+    else
     {
-        #if defined (CY_IP_MXCSDV2)
-            if (config->vdda < CY_CSDADC_VDDA_LIMITATION_2200)
-            {
-                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_1_16;
-            }
-            else if (config->vdda > CY_CSDADC_VDDA_LIMITATION_2750)
-            {
-                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_2_13;
-            }
-            else
-            {
-                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_1_60;
-            }
-        #elif defined(CY_IP_M0S8CSDV2)
-            if (config->vdda < CY_CSDADC_VDDA_LIMITATION_2733)
-            {
-                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_1_20;
-            }
-            else if (config->vdda > CY_CSDADC_VDDA_LIMITATION_4500)
+        /* Find the nearest cycle where at least one channel is due */
+        for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+        {
+            if ((0u != (context->chMask & (1uL << chId))) && (skipNum > context->chRateCnt[chId]))
             {
-                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_3_84;
+                skipNum = context->chRateCnt[chId];
             }
-            else
+        }
+
+        /* Schedule the due channels and count down the others */
+        for (chId = 0u; chId < context->cfgCopy.numChannels; chId++)
+        {
+            chBit = (uint32_t)(1uL << chId);
+            if (0u != (context->chMask & chBit))
             {
-                vRefDesired = (uint32_t)CY_CSDADC_VREF_CALIB_BASE_2_13;
+                if (skipNum == context->chRateCnt[chId])
+                {
+                    cycleMask |= chBit;
+                    context->chRateCnt[chId] = (uint8_t)(context->chRateDiv[chId] - 1u);
+                }
+                else
+                {
+                    context->chRateCnt[chId] -= (uint8_t)(skipNum + 1u);
+                }
             }
-        #else
-            #error Unsupported platform
-        #endif
-    }
-    else
-    {
-        vRefDesired = (uint32_t)config->vref;
-        /* Check for Vref limitations */
-        if (vRefDesired > ((uint32_t)config->vdda - CY_CSDADC_VREF_VDDA_MIN_DIFF))
-        {
-            vRefDesired = ((uint32_t)config->vdda - CY_CSDADC_VREF_VDDA_MIN_DIFF);
         }
     }
+    context->cycleMask = cycleMask;
 
-    /* Calculate Vref gain */
-    vGain = (((uint32_t)CY_CSDADC_VREF_GAIN_MAX * (uint32_t)CY_CSDADC_VREF_IN_SRSS) - 1u) / (vRefDesired + 1u);
-    if (vGain > ((uint32_t)CY_CSDADC_VREF_GAIN_MAX - 1u))
-    {
-        vGain = (uint32_t)CY_CSDADC_VREF_GAIN_MAX - 1u;
-    }
-    context->vRefGain = (uint8_t)vGain;
+    return (skipNum);
+}
 
-    /* Calculate Vref with rounding and store in the context structure */
-    context->vRefMv = (uint16_t)((((uint32_t)CY_CSDADC_VREF_GAIN_MAX * CY_CSDADC_VREF_IN_SRSS) + ((vGain + 1u) >> 1u))
-                                                                                                    / (vGain + 1u));
 
-    /* Update nominal Vref to real Vref */
-    context->vRefMv = (uint16_t)Cy_CSD_GetVrefTrim((uint32_t)context->vRefMv);
+/*******************************************************************************
+* Function Name: Cy_CSDADC_SetDivisor
+****************************************************************************//**
+*
+* Calculates the fixed-point reciprocal of the specified divisor.
+*
+* The reciprocal is exact for any 32-bit dividend, so
+* Cy_CSDADC_Divide() returns the same quotient as the integer division.
+* A power of two divisor is represented by a shift only. The zero divisor
+* is handled as 1.
+*
+* \param divisor
+* The divisor value.
+*
+* \param ptrDivisor
+* The pointer to the divisor structure to be updated.
+*
+*******************************************************************************/
+static void Cy_CSDADC_SetDivisor(
+                uint32_t divisor,
+                cy_stc_csdadc_divisor_t * ptrDivisor)
+{
+    uint32_t log2Ceil = 0u;
+    uint32_t tmpDivisor = (0u == divisor) ? 1u : divisor;
 
-    /* Define Vmax depending on CSDADC range */
-    if (CY_CSDADC_RANGE_VREF == config->range)
-    {
-        vMax = context->vRefMv;
-        context->vMaxMv = (uint16_t)vMax;
-    }
-    else
-    /* For 0-Vdda range determine what voltage is more Vdda-Vref or Vref */
+    while (((1uL << log2Ceil) < tmpDivisor) && (log2Ceil < CY_CSDADC_DIVISOR_MAX_SHIFT))
     {
-        vMax = (((config->vdda - context->vRefMv) > context->vRefMv) ?
-                                                ((uint32_t)config->vdda - context->vRefMv) : (uint32_t)context->vRefMv);
-        context->vMaxMv = config->vdda;
+        log2Ceil++;
     }
-    /* Max CSDADC code for IDAC calculation depends on resolution and must be multiplied by 2 for accuracy */
-    if (CY_CSDADC_RESOLUTION_8BIT == config->resolution)
+
+    if ((1uL << log2Ceil) == tmpDivisor)
     {
-        codeMaxIdac = CY_CSDADC_RES_8_PLUS_1_MAX_VAL;
+        ptrDivisor->mult = 0u;
+        ptrDivisor->shift = (uint8_t)log2Ceil;
     }
     else
     {
-        codeMaxIdac = CY_CSDADC_RES_10_PLUS_1_MAX_VAL;
+        /* mult = floor(2^32 * (2^log2Ceil - divisor) / divisor) + 1 */
+        ptrDivisor->mult = (uint32_t)((((uint64_t)((1uL << log2Ceil) - tmpDivisor)) << CY_CSDADC_DIVISOR_FRACT_BITS) /
+                                                                                        (uint64_t)tmpDivisor) + 1u;
+        ptrDivisor->shift = (uint8_t)(log2Ceil - 1u);
     }
+}
 
-    /* Depends on IDAC gain */
-    /* Calculate IDAC gain with an appropriate operation sequence to avoid overflow */
-    iDacGain = (config->periClk / codeMaxIdac) / config->operClkDivider;
-    iDacGain = (((iDacGain * vMax) / CY_CSDADC_MEGA) * CY_CSDADC_CREF) / CY_CSDADC_IDAC_LSB;
-    if (CY_CSDADC_IDAC_MAX < iDacGain)
-    {
-        iDacGain = CY_CSDADC_IDAC_MAX;
-    }
-    context->cfgCopy.idac = (uint8_t) iDacGain;
 
-    /* Set init value for tVssa2Vref. It'll be corrected after calibration */
-    context->tVssa2Vref = (uint16_t)codeMaxIdac;
-    /* Set init value for tRecover. It'll be corrected after calibration */
-    context->tRecover = (uint16_t)codeMaxIdac;
-    /* Set init value for tVdda2Vref. It'll be corrected after calibration */
-    nMax = (uint32_t)context->tVssa2Vref * ((uint32_t)context->cfgCopy.vdda - context->vRefMv);
-    context->tVdda2Vref = (uint16_t)(nMax / context->vRefMv);
-    /* Set init value for tFull. It'll be corrected after calibration */
-    context->tFull = context->tVssa2Vref + context->tVdda2Vref;
+/*******************************************************************************
+* Function Name: Cy_CSDADC_Divide
+****************************************************************************//**
+*
+* Divides the dividend by the divisor with the precalculated reciprocal.
+*
+* \param dividend
+* The dividend value.
+*
+* \param ptrDivisor
+* The pointer to the divisor structure, calculated by Cy_CSDADC_SetDivisor().
+*
+* \return
+* Returns the quotient rounded down.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_Divide(
+                uint32_t dividend,
+                const cy_stc_csdadc_divisor_t * ptrDivisor)
+{
+    uint32_t quotient;
 
-    /* Max CSDADC code depends on resolution */
-    if (CY_CSDADC_RESOLUTION_8BIT == config->resolution)
+    if (0u == ptrDivisor->mult)
     {
-        context->codeMax = (uint16_t)CY_CSDADC_RES_8_MAX_VAL;
+        quotient = dividend >> ptrDivisor->shift;
     }
     else
     {
-        context->codeMax = (uint16_t)CY_CSDADC_RES_10_MAX_VAL;
-    }
-
-    /* Calculate snsClkDivider as small as possible */
-    /* Choose the max time interval */
-    nMax = config->acqTime;
-    if (config->azTime > nMax)
-    {
-        nMax = config->azTime;
-    }
-    nMax = (nMax * (config->periClk / CY_CSDADC_MEGA)) / config->operClkDivider;
-    while (((nMax / snsClkDiv) >= CY_CSDADC_MAX_SNSCLK_CYCLES) && (snsClkDiv < CY_CSDADC_MAX_SNSCLK_DIVIDER))
-    {
-        snsClkDiv++;
+        quotient = (uint32_t)(((uint64_t)dividend * ptrDivisor->mult) >> CY_CSDADC_DIVISOR_FRACT_BITS);
+        quotient = (quotient + ((dividend - quotient) >> 1u)) >> ptrDivisor->shift;
     }
-    context->acqCycles = (uint8_t)((config->acqTime * (config->periClk / CY_CSDADC_MEGA)) / config->operClkDivider / snsClkDiv);
-    context->azCycles = (uint8_t)((config->azTime * (config->periClk / CY_CSDADC_MEGA)) / config->operClkDivider / snsClkDiv);
-    context->snsClkDivider = (uint8_t)snsClkDiv;
 
-    /* Set INIT done */
-    context->status |= (uint16_t)CY_CSDADC_INIT_DONE;
+    return (quotient);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_SetAdcChannel
+* Function Name: Cy_CSDADC_StreamPush
 ****************************************************************************//**
 *
-* Sets the given channel to the given state.
-*
-* Connects/disconnects the pin and the analog muxbus B. Sets the drive mode
-* of the pin as well.
+* Appends the converted sample to the stream buffer. If the buffer is full,
+* the sample is dropped and the overrun counter is incremented.
 *
 * \param chId
-* The ID of the channel to be set.
+* The ID of the converted channel.
 *
-* \param state
-* The state in which the channel is to be put:
-* * (0) CY_CSDADC_CHAN_DISCONNECT
-* * (1) CY_CSDADC_CHAN_CONNECT
+* \param code
+* The conversion result as ADC code.
 *
 * \param context
 * The pointer to the CSDADC middleware context structure.
 *
 *******************************************************************************/
-static void Cy_CSDADC_SetAdcChannel(
+static void Cy_CSDADC_StreamPush(
                 uint32_t chId,
-                uint32_t state,
-                const cy_stc_csdadc_context_t * context)
+                uint32_t code,
+                cy_stc_csdadc_context_t * context)
 {
-    cy_stc_csdadc_ch_pin_t const ptr2adcIO = context->cfgCopy.ptrPinList[chId];
-    uint32_t  interruptState= Cy_SysLib_EnterCriticalSection();
-    switch (state)
-    {
-    case CY_CSDADC_CHAN_CONNECT:
-        /* Connect AMuxBusB to the selected port */
-        Cy_GPIO_SetHSIOM(ptr2adcIO.ioPcPtr, (uint32_t)ptr2adcIO.pin, HSIOM_SEL_AMUXB);
-        /* Update port configuration register (drive mode) to High-Z Analog */
-        Cy_GPIO_SetDrivemode(ptr2adcIO.ioPcPtr, (uint32_t)ptr2adcIO.pin, CY_GPIO_DM_ANALOG);
-        break;
+    cy_stc_csdadc_stream_t * ptrStream = &context->stream;
+    cy_stc_csdadc_sample_t * ptrSample;
+    uint32_t head = ptrStream->head;
 
-    /* Disconnection is a safe default state. Fall-through is intentional. */
-    case CY_CSDADC_CHAN_DISCONNECT:
-    default:
-        /* Disconnect AMuxBusB from the selected port */
-        Cy_GPIO_SetHSIOM(ptr2adcIO.ioPcPtr, (uint32_t)ptr2adcIO.pin, HSIOM_SEL_GPIO);
-        break;
+    if ((head - ptrStream->tail) > ptrStream->sizeMask)
+    {
+        ptrStream->overrunCnt++;
+    }
+    else
+    {
+        ptrSample = &ptrStream->ptrBuf[head & ptrStream->sizeMask];
+        ptrSample->cycle = context->counter & CY_CSDADC_COUNTER_CYCLE_MASK;
+        ptrSample->code = (uint16_t)code;
+        ptrSample->chId = (uint8_t)chId;
+        /* Publish the sample only after it is written */
+        __DMB();
+        ptrStream->head = head + 1u;
     }
-    Cy_SysLib_ExitCriticalSection(interruptState);
 }
 
+
 /*******************************************************************************
-* Function Name: Cy_CSDADC_StartFSM
+* Function Name: Cy_CSDADC_StoreResult
 ****************************************************************************//**
 *
-* Starts the CSD state machine with correct parameters to initialize an ADC
-* conversion.
+* Scales the accumulated conversion time of the channel, stores the channel
+* result, and updates the enabled result consumers: the stream buffer,
+* the limit detection, the statistics, the extended results and
+* the result frames.
 *
-* \param measureMode
-* The FSM mode:
-* * (0) CY_CSDADC_MEASMODE_OFF
-* * (1) CY_CSDADC_MEASMODE_VREF
-* * (2) CY_CSDADC_MEASMODE_VREFBY2
-* * (3) CY_CSDADC_MEASMODE_VIN
+* \param chId
+* The ID of the converted channel.
 *
 * \param context
 * The pointer to the CSDADC middleware context structure.
 *
 *******************************************************************************/
-static void Cy_CSDADC_StartFSM(
-                uint32_t measureMode,
-                const cy_stc_csdadc_context_t * context)
+static void Cy_CSDADC_StoreResult(
+                uint32_t chId,
+                cy_stc_csdadc_context_t * context)
 {
-    uint32_t tmpStartVal = (uint32_t)(measureMode << CY_CSDADC_ADC_CTL_MEAS_POS) | ((uint32_t)context->acqCycles - 1u);
-    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
+    uint32_t tmpResult;
+    uint32_t range = Cy_CSDADC_GetChRange(chId, context);
 
-    /* Set the mode and acquisition time */
-    ptrCsdBaseAdd->ADC_CTL = tmpStartVal;
+    /* Average time multiplied by 2^oversampling */
+    tmpResult = context->osSum >> (uint32_t)context->cfgCopy.oversampling;
+    context->osSum = 0u;
+    tmpResult = Cy_CSDADC_ScaleResult(tmpResult, range, context);
 
-    if(CY_CSDADC_MEASMODE_OFF == measureMode)
+    /* Store the ADC result code */
+    context->adcResult[chId].code = (uint16_t)(tmpResult);
+    /* Append the sample to the stream buffer if the streaming mode is enabled */
+    if (NULL != context->stream.ptrBuf)
     {
-        tmpStartVal = CY_CSDADC_FSM_ABORT;
+        Cy_CSDADC_StreamPush(chId, tmpResult, context);
     }
-    /* This setting is used for MEASMODE_VREF, MEASMODE_VREFBY2, and MEASMODE_VIN */
-    else
+    /* Check the channel thresholds if the limit detection is enabled */
+    if ((NULL != context->ptrLimit) && (0u != (context->limitMask & (1uL << chId))))
     {
-        tmpStartVal = CY_CSDADC_FSM_AZ_SKIP_DEFAULT | CY_CSDADC_FSM_START;
+        Cy_CSDADC_CheckLimit(chId, tmpResult, context);
+    }
+    /* Accumulate the channel statistics if they are enabled */
+    if ((NULL != context->ptrStat) && (0u != (context->statMask & (1uL << chId))))
+    {
+        Cy_CSDADC_UpdateStat(chId, tmpResult, context);
+    }
+    /* Scales the result to mV with rounding and stores it */
+    tmpResult = Cy_CSDADC_CodeToMv(tmpResult, range, context);
+    context->adcResult[chId].mVolts = (uint16_t)(tmpResult);
+    /* Store the extended result if it is enabled */
+    if (NULL != context->ptrResultExt)
+    {
+        context->ptrResultExt[chId].seq++;
+        context->ptrResultExt[chId].timestamp = Cy_CSDADC_GetTimestamp(context);
+        context->ptrResultExt[chId].code = context->adcResult[chId].code;
+        context->ptrResultExt[chId].mVolts = (uint16_t)(tmpResult);
+    }
+    /* Store the result to the back frame if the result frames are enabled */
+    if (NULL != context->ptrFrame)
+    {
+        context->ptrFrame[context->frameWrite].result[chId] = context->adcResult[chId];
+        context->ptrFrame[context->frameWrite].chMask |= (uint32_t)(1uL << chId);
     }
-    /* Unmask ADC_RES interrupt (enable interrupt) */
-    ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_ADC_RES_MSK;
-    /* Start CSD sequencer */
-    ptrCsdBaseAdd->SEQ_START = tmpStartVal;
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_StartAndWait
+* Function Name: Cy_CSDADC_RawPush
 ****************************************************************************//**
 *
-* Starts the CSD state machine and waits until the conversion ends.
+* Appends the raw conversion result to the raw capture buffer. If the buffer
+* is full, the result is dropped and the overrun counter is incremented.
 *
-* Starts the CSD state machine with correct parameters to initialize an ADC
-* conversion and waits until the conversion ends. To prevent hanging,
-* a program watchdog is used.
+* \param chId
+* The ID of the converted channel.
 *
-* \param measureMode
-* The FSM mode:
-* * (1) CY_CSDADC_MEASMODE_VREF
-* * (2) CY_CSDADC_MEASMODE_VREFBY2
-* * (3) CY_CSDADC_MEASMODE_VIN
+* \param adcRes
+* The conversion result value with the HSCMP polarity bit from the ADC_RES
+* register.
 *
 * \param context
 * The pointer to the CSDADC middleware context structure.
 *
-* \return
-* The function returns the result of the conversion. If an overflow occurs
-* or the watchdog triggers, CY_CSDADC_MEASUREMENT_FAILED is returned.
-*
 *******************************************************************************/
-static uint32_t Cy_CSDADC_StartAndWait(
-                uint32_t measureMode,
-                const cy_stc_csdadc_context_t * context)
+static void Cy_CSDADC_RawPush(
+                uint32_t chId,
+                uint32_t adcRes,
+                cy_stc_csdadc_context_t * context)
 {
-    CSD_Type * ptrCsdBaseAdd = context->cfgCopy.base;
-
-    uint32_t tmpStartVal = (uint32_t)(measureMode << CY_CSDADC_ADC_CTL_MEAS_POS) | ((uint32_t)context->acqCycles - 1u);
-    uint32_t tmpRetVal = CY_CSDADC_MEASUREMENT_FAILED;
-    uint32_t tmpResult;
-
-    uint32_t watchdogAdcCounter = CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM;
+    cy_stc_csdadc_raw_capture_t * ptrRaw = &context->raw;
+    cy_stc_csdadc_raw_sample_t * ptrSample;
+    uint32_t head = ptrRaw->head;
 
-    /* start CSDADC conversion with desired the mode and acquisition time */
-    ptrCsdBaseAdd->ADC_CTL = tmpStartVal;
-    ptrCsdBaseAdd->SEQ_START = CY_CSDADC_FSM_AZ_SKIP_DEFAULT | CY_CSDADC_FSM_START;
-
-    /* Check for watchdog counter */
-    while ((0u == (ptrCsdBaseAdd->INTR & CY_CSDADC_CSD_INTR_MASK_ADC_RES_MSK)) &&  (0u != watchdogAdcCounter))
+    if ((head - ptrRaw->tail) > ptrRaw->sizeMask)
     {
-        /* Wait until scan complete and decrement Watchdog Counter to prevent unending loop */
-        watchdogAdcCounter--;
+        ptrRaw->overrunCnt++;
     }
-
-    /* Clear all pending interrupts of the CSD HW block */
-    ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
-    (void)ptrCsdBaseAdd->INTR;
-
-    if (0u != watchdogAdcCounter)
+    else
     {
-        /* Read ADC result and check for ADC_ABORT or ADC_OVERFLOW flags */
-        tmpResult = ptrCsdBaseAdd->ADC_RES;
-        if (0u == (tmpResult & CY_CSDADC_ADC_RES_ABORT_MASK))
-        {
-            if (0u == (tmpResult & CY_CSDADC_ADC_RES_OVERFLOW_MASK))
-            {
-                tmpRetVal = tmpResult;
-            }
-        }
+        ptrSample = &ptrRaw->ptrBuf[head & ptrRaw->sizeMask];
+        ptrSample->adcRes = adcRes;
+        ptrSample->chId = (uint8_t)chId;
+        /* Publish the sample only after it is written */
+        __DMB();
+        ptrRaw->head = head + 1u;
     }
-    return (tmpRetVal);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_StartConvert
+* Function Name: Cy_CSDADC_UpdateDivisors
 ****************************************************************************//**
 *
-* Initiates an analog-to-digital conversion.
-*
-* Initializes the CSD HW block to perform an analog-to-digital conversion
-* on input channels specified by chMask.
-* This is a non-blocking function. It initiates a conversion only on the first
-* input channel and does not wait for the conversion to complete.
-* A conversion on subsequent channels is initiated by the interrupt service
-* routine of the CSDADC middleware. Therefore, the Cy_CSDADC_IsEndConversion()
-* function must be used to check the conversion status to ensure
-* the previously initiated conversion is complete prior to initiating
-* other tasks. These include: reading the ADC result, initiation of a new
-* conversion on the same or a different channel, or calibration or
-* stopping a CSDADC conversion.
+* Updates the reciprocals of the calibration data used to scale the
+* conversion results. Must be called after tFull, tVssa2Vref, codeMax, or
+* the oversampling is changed.
 *
-* In Single-shot mode, the CSDADC middleware performs one conversion
-* on all channels specified by the chMask argument and stops.
-* The Cy_CSDADC_IsEndConversion() function returns the CY_CSDADC_SUCCESS status
-* after conversion on all channels completes. Otherwise, it returns the
-* CY_CSDADC_HW_BUSY state. To get information on the latest conversion,
-* use the Cy_CSDADC_GetConversionStatus() function.
+* \param context
+* The pointer to the CSDADC middleware context structure.
 *
-* In Continuous mode, this function continuously initiates conversions
-* on channels specified by chMask (i.e. once a conversion is completed
-* on all channels specified by chMask, the CSDADC MW initiates a next set
-* of conversions). The Cy_CSDADC_IsEndConversion() function
-* always returns the CY_CSDADC_HW_BUSY status. To get information on the latest
-* conversion, use the Cy_CSDADC_GetConversionStatus() functions.
+*******************************************************************************/
+static void Cy_CSDADC_UpdateDivisors(
+                cy_stc_csdadc_context_t * context)
+{
+    Cy_CSDADC_SetDivisor((uint32_t)context->tFull, &context->divFull);
+    Cy_CSDADC_SetDivisor((uint32_t)context->tVssa2Vref, &context->divVssa2Vref);
+    Cy_CSDADC_SetDivisor((uint32_t)context->codeMax << (uint32_t)context->cfgCopy.oversampling, &context->divCodeMax);
+}
 
-* \param mode
-* The desired mode of conversion:
-* * CY_CSDADC_SINGLE_SHOT - Only one conversion cycle of all chosen channels.
-* * CY_CSDADC_CONTINUOUS - Continuous mode.
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetTime
+****************************************************************************//**
 *
-* \param chMask
-* The bit mask with set bits of specified channels to convert.
+* Converts the raw conversion result to the time to charge Cref from Vssa
+* to the input voltage in clock cycles, depending on sourcing or sinking
+* mode. Checks for saturation in all modes.
 *
-* \param context
-* The pointer to the CSDADC middleware context structure.
+* \param adcValue
+* The conversion result value from the ADC_RES register.
 *
-* \return
-* The function returns the status of its operation.
-* * CY_CSDADC_SUCCESS         - A conversion is started.
-* * CY_CSDADC_HW_BUSY         - A conversion is not started. The previously
-*                               initiated conversion is in progress or
-*                               the CSD HW block is in use by another
-*                               application.
-* * CY_CSDADC_BAD_PARAM       - A conversion is not started. The invalid mode
-*                               value or chMask is 0 or the context
-*                               pointer is NULL.
-* * CY_CSDADC_NOT_INITIALIZED - CSDADC to be initialized by using the
-*                               Cy_CSDADC_Init() and Cy_CSDADC_Enable()
-*                               functions.
+* \param polarity
+* The HSCMP polarity bit from the ADC_RES register.
 *
-* \funcusage
+* \param range
+* The range of the converted channel returned by Cy_CSDADC_GetChRange().
 *
-* An example of the conversion executing in Single-shot mode:
-* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
-* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionSingleShot
+* \param context
+* The pointer to the CSDADC middleware context structure.
 *
-* An example of the conversion executing in Continuous mode:
-* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
-* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionContinuous
+* \return
+* Returns the time between 0 and tFull.
 *
 *******************************************************************************/
-cy_en_csdadc_status_t Cy_CSDADC_StartConvert(
-                cy_en_csdadc_conversion_mode_t mode,
-                uint32_t chMask,
-                cy_stc_csdadc_context_t * context)
+static uint32_t Cy_CSDADC_GetTime(
+                uint32_t adcValue,
+                uint32_t polarity,
+                uint32_t range,
+                const cy_stc_csdadc_context_t * context)
 {
-    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
-    uint8_t chId = 0u;
-
-    CY_ASSERT_L1(NULL != context);
+    uint32_t tmpResult = adcValue;
 
-    if ((NULL == context) || ((mode != CY_CSDADC_SINGLE_SHOT) && (mode != CY_CSDADC_CONTINUOUS)) ||
-            (chMask == 0u) || (chMask > ((uint32_t)(0x01uL << context->cfgCopy.numChannels) - 1u)))
+    /* HSCMP polarity is 0:sink, 1:source */
+    if(0u != polarity) /* Sourcing */
     {
-        result = CY_CSDADC_BAD_PARAM;
+        /* Saturate result at tVssa2Vref */
+        tmpResult = (tmpResult > (uint32_t)context->tVssa2Vref) ? (uint32_t)context->tVssa2Vref : tmpResult;
+        tmpResult = (uint32_t)context->tVssa2Vref - tmpResult;
     }
-    else
+    else /* Sinking */
     {
-        /* Check whether the CSDADC is configured */
-        if ((uint16_t)CY_CSDADC_INIT_DONE != (context->status & (uint16_t)CY_CSDADC_INIT_MASK))
+        if ((uint32_t)CY_CSDADC_RANGE_VDDA == range)
         {
-            result = CY_CSDADC_NOT_INITIALIZED;
+            /* Scale result with sink/source mismatch with rounding */
+            tmpResult = Cy_CSDADC_Divide(((uint32_t)((uint32_t)context->tRecover << 1u) * tmpResult) +
+                                                    ((uint32_t)context->tVssa2Vref >> 1u), &context->divVssa2Vref);
+            /* Saturate result at t_Vdda2Vref*/
+            tmpResult = (tmpResult > (uint32_t)context->tVdda2Vref) ? (uint32_t)context->tVdda2Vref : tmpResult;
+            tmpResult += (uint32_t)context->tVssa2Vref;
         }
         else
         {
-            if(CY_CSDADC_SUCCESS != Cy_CSDADC_IsEndConversion(context))
-            {
-                result = CY_CSDADC_HW_BUSY;
-            }
-            else
-            {
-                /* Save chMask to the context structure */
-                context->chMask = chMask;
-                /* Set the conversion mode bits of the CSDADC status byte */
-                context->status &= (uint16_t)~(uint16_t)CY_CSDADC_CONV_MODE_MASK;
-                context->status |= (uint16_t)(((uint32_t)mode) << CY_CSDADC_CONV_MODE_BIT_POS);
-
-                /* Choose the first desired channel to convert */
-                chId = Cy_CSDADC_GetNextCh(0u, context);
-                /* Configure a desired channel if needed */
-                if (chId != context->activeCh)
-                {
-                    if (CY_CSDADC_NO_CHANNEL != context->activeCh)
-                    {
-                        /* Disconnect existing input channel */
-                        Cy_CSDADC_SetAdcChannel((uint32_t)context->activeCh, CY_CSDADC_CHAN_DISCONNECT, context);
-                    }
-                    /* Connect desired input channel */
-                    Cy_CSDADC_SetAdcChannel((uint32_t)chId, CY_CSDADC_CHAN_CONNECT, context);
-                    context->activeCh = chId;
-                }
-
-                /* Set the cycle counter to zero and the number of the first channel to convert to the conversion counter */
-                context->counter = (uint32_t)(((uint32_t)chId) << CY_CSDADC_COUNTER_CHAN_POS);
-                /* Clear stop bits */
-                context->status &= (uint16_t)~CY_CSDADC_STOP_BITS_MASK;
-                /* Set the busy bit of the CSDADC status byte */
-                context->status |= CY_CSDADC_STATUS_BUSY_MASK;
-                /* Set CSDADC FSM status */
-                context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
-                context->status |= (uint16_t)CY_CSDADC_STATUS_CONVERTING;
-                /* Start conversion */
-                Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, context);
-            }
+            /* In vref mode, we are not supposed to be sinking. Saturate */
+            tmpResult = (uint32_t)context->tVssa2Vref;
         }
     }
 
-    return (result);
+    return (tmpResult);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_StopConvert
+* Function Name: Cy_CSDADC_ScaleResult
 ****************************************************************************//**
 *
-* The function stops conversions in Continuous mode.
-*
-* This function can be used to stop CSDADC conversions in Continuous mode.
-* The ADC can be stopped instantly by ignoring current and all future
-* conversions in the queue. Or it can be stopped after the current conversion on
-* an input channel is completed but future conversions in the queue are ignored.
-* Or it can be stopped after the current conversion cycle (i.e. one set of
-* conversion on all enabled inputs) is completed and conversion
-* cycles in the queue are ignored.
+* Scales the time to the CSDADC code with rounding.
 *
-* Check the ADC status using the Cy_CSDADC_IsEndConversion() function.
-* Start a new conversion or calibration only if the CSDADC is not busy.
+* \param time
+* The time returned by Cy_CSDADC_GetTime(). In the oversampling mode,
+* the average time multiplied by 2^oversampling.
 *
-* \param stopMode
-* The desired mode of the stop operation. It can be:
-* * CY_CSDADC_IMMED_STOP        - The CSDADC conversion will be stopped
-*                                 immediately. A last channel conversion
-*                                 may produce an invalid result.
-* * CY_CSDADC_CURRENT_CHAN_STOP - The CSDADC conversion will be stopped after
-*                                 the current channel conversion to be completed.
-* * CY_CSDADC_ENABLED_CHAN_STOP - The CSDADC conversion will be stopped after
-*                                 all the enabled channels conversions to be
-*                                 completed.
+* \param range
+* The range of the converted channel returned by Cy_CSDADC_GetChRange().
 *
 * \param context
 * The pointer to the CSDADC middleware context structure.
 *
 * \return
-* The function returns the next statuses:
-* * CY_CSDADC_SUCCESS   - The operation stopped successfully. The CSDADC conversion
-                          is stopped in the case of immediate Stop mode or
-                          the stop conversion bit in the CSDADC status byte is
-                          set to stop conversions after the current channel or
-                          all the enabled channels are completed.
-* * CY_CSDADC_BAD_PARAM - The input parameter is invalid.
-* * CY_CSDADC_TIMEOUT   - The CSD HW block did not stop within the expected
-*                         time frame.
+* Returns the CSDADC code.
 *
 *******************************************************************************/
-cy_en_csdadc_status_t Cy_CSDADC_StopConvert(
-                cy_en_csdadc_stop_mode_t stopMode,
-                cy_stc_csdadc_context_t * context)
+static uint32_t Cy_CSDADC_ScaleResult(
+                uint32_t time,
+                uint32_t range,
+                const cy_stc_csdadc_context_t * context)
 {
-    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
-    CSD_Type * ptrCsdBaseAdd;
-    uint32_t watchdogAdcCounter;
-
-    CY_ASSERT_L1(NULL != context);
+    uint32_t tmpResult;
 
-    if ((NULL == context) || ((CY_CSDADC_IMMED_STOP != stopMode) &&
-                            (CY_CSDADC_CURRENT_CHAN_STOP != stopMode) &&
-                            (CY_CSDADC_ENABLED_CHAN_STOP != stopMode)))
+    if ((uint32_t)CY_CSDADC_RANGE_VREF == range)
     {
-        result = CY_CSDADC_BAD_PARAM;
+        /* The full range time of the Vref range is tVssa2Vref */
+        tmpResult = Cy_CSDADC_Divide((time * context->codeMax) + ((uint32_t)context->tVssa2Vref >> 1u),
+                                                                                &context->divVssa2Vref);
     }
     else
     {
-        if (CY_CSDADC_IMMED_STOP == stopMode)
-        {
-            ptrCsdBaseAdd = context->cfgCopy.base;
-
-            /* Mask all CSD HW block interrupts (disable all interrupts) */
-            ptrCsdBaseAdd->INTR_MASK = CY_CSDADC_CSD_INTR_MASK_CLEAR_MSK;
-
-            /* Stop the CSD HW block sequencer */
-            ptrCsdBaseAdd->SEQ_START = CY_CSDADC_FSM_ABORT;
-
-            /* Initialize Watchdog Counter with a time interval that is enough for the ADC operation to complete */
-            watchdogAdcCounter = CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM;
-            while ((CY_CSD_SUCCESS != Cy_CSD_GetConversionStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
-                                                                                     &&  (0u != watchdogAdcCounter))
-            {
-                /* Wait until scan complete and decrement Watchdog Counter to prevent unending loop */
-                watchdogAdcCounter--;
-            }
+        tmpResult = Cy_CSDADC_Divide((time * context->codeMax) + ((uint32_t)context->tFull >> 1u), &context->divFull);
+    }
 
-            /* Clear all pending interrupts of the CSD HW block */
-            ptrCsdBaseAdd->INTR = CY_CSDADC_CSD_INTR_ALL_MSK;
-            (void)ptrCsdBaseAdd->INTR;
+    return (tmpResult);
+}
 
-            if (0u == watchdogAdcCounter)
-            {
-                result = CY_CSDADC_TIMEOUT;
-            }
-            /* Clear all status bits except the initialization bit */
-            context->status &= (uint16_t)CY_CSDADC_INIT_MASK;
 
-        }
-        else if (CY_CSDADC_CURRENT_CHAN_STOP == stopMode)
-        {
-            context->status &= (uint16_t)~(CY_CSDADC_STOP_BITS_MASK);
-            context->status |= (uint16_t)(((uint32_t)CY_CSDADC_CURRENT_CHAN_STOP) << CY_CSDADC_STOP_BITS_POS);
-        }
-        else
-        {
-            context->status &= (uint16_t)~(CY_CSDADC_STOP_BITS_MASK);
-            context->status |= (uint16_t)(((uint32_t)CY_CSDADC_ENABLED_CHAN_STOP) << CY_CSDADC_STOP_BITS_POS);
-        }
-    }
-    return result;
+/*******************************************************************************
+* Function Name: Cy_CSDADC_CodeToMv
+****************************************************************************//**
+*
+* Scales the CSDADC code to mV with rounding.
+*
+* \param code
+* The CSDADC code. In the oversampling mode, the oversampled code.
+*
+* \param range
+* The range of the converted channel returned by Cy_CSDADC_GetChRange().
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* Returns the input voltage in mV.
+*
+*******************************************************************************/
+static uint32_t Cy_CSDADC_CodeToMv(
+                uint32_t code,
+                uint32_t range,
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t codeMax = (uint32_t)context->codeMax << (uint32_t)context->cfgCopy.oversampling;
+    uint32_t vMaxMv = ((uint32_t)CY_CSDADC_RANGE_VREF == range) ? context->vRefMv : context->vMaxMv;
+
+    return (Cy_CSDADC_Divide((vMaxMv * code) + (codeMax >> 1u), &context->divCodeMax));
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_IsEndConversion
+* Function Name: Cy_CSDADC_GetChRange
 ****************************************************************************//**
 *
-* The function returns the status of the CSDADC's operation.
+* Returns the range of the channel. The channels set in the chRangeVref mask
+* are converted in the Vref range when the Vdda range is configured.
 *
-* This function is used to ensure that the CSDADC is in the idle state prior
-* to initiating a conversion, calibration, or configuration change.
-* Initiating any ADC operation while the CSDADC is in the busy state may
-* produce unexpected results from the ADC.
+* \param chId
+* The ID of the channel.
 *
 * \param context
-* The pointer to the CSDADC context.
+* The pointer to the CSDADC middleware context structure.
 *
 * \return
-* The function returns the status of the ADC operation.
-* * CY_CSDADC_SUCCESS   - The ADC is not busy, so
-*                         a new conversion can be initiated.
-* * CY_CSDADC_BAD_PARAM - A conversion is not started. The invalid mode
-*                         value or chMask is 0 or the context
-*                         pointer is NULL.
-* * CY_CSDADC_HW_BUSY   - The previously initiated conversion is in progress.
-* * CY_CSDADC_OVERFLOW  - The most recent conversion caused an overflow. The root
-*                         cause of the overflow may be the previous calibration
-*                         values being invalid or the VDDA value is incorrect.
-*                         Perform re-calibration or set the appropriate VDDA
-*                         value to avoid this error condition.
-*
-* \funcusage
-*
-* An example of the Cy_CSDADC_IsEndConversion() function usage:
-* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
-* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionSingleShot
+* Returns the range of the channel.
 *
 *******************************************************************************/
-cy_en_csdadc_status_t Cy_CSDADC_IsEndConversion(
+static uint32_t Cy_CSDADC_GetChRange(
+                uint32_t chId,
                 const cy_stc_csdadc_context_t * context)
 {
-    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
-    CSD_Type * ptrCsdBaseAdd;
-
-    CY_ASSERT_L1(NULL != context);
+    uint32_t range = (uint32_t)context->cfgCopy.range;
 
-    if (NULL == context)
+    if (0u != (context->cfgCopy.chRangeVref & (1uL << chId)))
     {
-        result = CY_CSDADC_BAD_PARAM;
+        range = (uint32_t)CY_CSDADC_RANGE_VREF;
     }
-    else
-    {
-        ptrCsdBaseAdd = context->cfgCopy.base;
 
-        if (0u != (ptrCsdBaseAdd->ADC_RES & CY_CSDADC_ADC_RES_OVERFLOW_MASK))
-        {
-            result = CY_CSDADC_OVERFLOW;
-        }
-        else if (0u != (CY_CSDADC_STATUS_BUSY_MASK & context->status))
-        {
-           result = CY_CSDADC_HW_BUSY;
-        }
-        else
-        {
-            /* Does nothing; result = CY_CSDADC_SUCCESS */
-        }
-    }
-    return result;
+    return (range);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_GetConversionStatus
+* Function Name: Cy_CSDADC_ResultToMv
 ****************************************************************************//**
 *
-* The function returns a current CSDADC conversion status.
+* Scales a single raw conversion result to mV with rounding.
 *
-* In Continuous mode, this function returns a combination of the current channel
-* number and current cycle number. This function can be used to identify whether
-* a cycle of conversion completed or identify the latest input where
-* the conversion completed so a result can be read.
-* In Single-shot mode, only the latest input where a conversion completed is returned.
-* A conversion cycle number is incremented by the CSDADC after each cycle
-* of conversion completes. A channel number is assigned to each input channel.
-* A new start-conversion request resets the conversion cycle number to zero and
-* the channel number to the first enabled channel in the chMask parameter.
+* \param adcValue
+* The conversion result value from the ADC_RES register.
+*
+* \param polarity
+* The HSCMP polarity bit from the ADC_RES register.
 *
 * \param context
-* The pointer to the CSDADC context.
+* The pointer to the CSDADC middleware context structure.
 *
 * \return
-* The function returns a combination of the conversion number and channel number.
-* * Bit[0-26]  The current cycle number in Continuous mode. In the single
-*              shot mode, it is equal to 0u.
-* * Bit[27-31] A current input channel number inside the current cycle.
-* * If the context parameter is equal to NULL, then the function
-*   returns \ref CY_CSDADC_COUNTER_BAD_PARAM.
+* Returns the input voltage in mV.
 *
-* \funcusage
+*******************************************************************************/
+static uint32_t Cy_CSDADC_ResultToMv(
+                uint32_t adcValue,
+                uint32_t polarity,
+                const cy_stc_csdadc_context_t * context)
+{
+    uint32_t range = (uint32_t)context->cfgCopy.range;
+    uint32_t tmpResult = Cy_CSDADC_GetTime(adcValue, polarity, range, context);
+
+    tmpResult = Cy_CSDADC_ScaleResult(tmpResult, range, context);
+
+    return (Cy_CSDADC_CodeToMv(tmpResult << (uint32_t)context->cfgCopy.oversampling, range, context));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetTimestamp
+****************************************************************************//**
 *
-* An example of the Cy_CSDADC_GetConversionStatus() function usage:
-* \snippet csdadc/snippet/main.c snippet_csdadc_chResult_declaration
-* \snippet csdadc/snippet/main.c snippet_Cy_CSDADC_RunConversionContinuous
+* Returns the timestamp of the registered timestamp function or 0 if
+* the function is not registered.
+*
+* \param context
+* The pointer to the CSDADC middleware context structure.
+*
+* \return
+* The timestamp.
 *
 *******************************************************************************/
-uint32_t Cy_CSDADC_GetConversionStatus(const cy_stc_csdadc_context_t * context)
+static uint32_t Cy_CSDADC_GetTimestamp(
+                const cy_stc_csdadc_context_t * context)
 {
-    uint32_t result = CY_CSDADC_COUNTER_BAD_PARAM;
-
-    CY_ASSERT_L1(NULL != context);
+    uint32_t timestamp = 0u;
 
-    if (NULL != context)
+    if (NULL != context->ptrTimestamp)
     {
-        result = context->counter;
+        timestamp = context->ptrTimestamp();
     }
 
-    return (result);
+    return (timestamp);
 }
 
 
 /*******************************************************************************
-* Function Name: Cy_CSDADC_Calibrate
+* Function Name: Cy_CSDADC_CalcCrc
 ****************************************************************************//**
 *
-* Performs calibration of the CSDADC.
+* Calculates the CRC-16-CCITT of the specified data.
 *
-* Executes calibration for the CSDADC to identify optimal CSD HW block
-* configuration to produce accurate results. The configuration parameters
-* are dependent on VDDA, VREF, IDAC, and PERI_CLK tolerances, and hence
-* run calibrations periodically (for example every 10 seconds)
-* to compensate for variation in the above mentioned parameters.
+* \param ptrData
+* The pointer to the data.
 *
-* \param context
-* The pointer to the CSDADC context structure.
+* \param size
+* The size of the data in bytes.
 *
 * \return
-* The function returns the status of its operation.
-* * CY_CSDADC_SUCCESS          - The CSD HW block is successfully calibrated for
-*                                the ADC use.
-* * CY_CSDADC_BAD_PARAM        - The context pointer is NULL. Calibration has not
-*                                been executed.
-* * CY_CSDADC_HW_BUSY          - The CSD HW block is already in use by the previously
-*                                initialized conversion or another function.
-*                                Calibration has not been executed.
-* * CY_CSDADC_CALIBRATION_FAIL - The operation watchdog is triggered.
-*                                The calibration was not performed.
+* The CRC of the data.
 *
 *******************************************************************************/
-cy_en_csdadc_status_t Cy_CSDADC_Calibrate(cy_stc_csdadc_context_t * context)
+static uint16_t Cy_CSDADC_CalcCrc(
+                const uint8_t * ptrData,
+                uint32_t size)
 {
-    uint32_t watchdogAdcCounter;
-    CSD_Type * ptrCsdBaseAdd;
-
-    cy_en_csdadc_status_t result = CY_CSDADC_SUCCESS;
+    uint32_t byteIndex;
+    uint32_t bitIndex;
+    uint32_t crc = CY_CSDADC_CRC_SEED;
 
-    CY_ASSERT_L1(NULL != context);
-
-    if (NULL == context)
-    {
-        result = CY_CSDADC_BAD_PARAM;
-    }
-    else
+    for (byteIndex = 0u; byteIndex < size; byteIndex++)
     {
-        if (CY_CSD_SUCCESS != Cy_CSD_GetConversionStatus(context->cfgCopy.base, context->cfgCopy.csdCxtPtr))
-        {
-            result = CY_CSDADC_HW_BUSY;
-        }
-        else
+        crc ^= (uint32_t)ptrData[byteIndex] << 8u;
+        for (bitIndex = 0u; bitIndex < 8u; bitIndex++)
         {
-            /* Disconnect channels if connected */
-            if (CY_CSDADC_NO_CHANNEL != context->activeCh)
-            {
-                /* Disconnect existing input channel */
-                Cy_CSDADC_ClearChannels(context);
-                context->activeCh = CY_CSDADC_NO_CHANNEL;
-            }
-
-            ptrCsdBaseAdd = context->cfgCopy.base;
-            ptrCsdBaseAdd->IDACB = CY_CSDADC_IDACB_CONFIG | context->cfgCopy.idac;
-
-            /* Set the busy bit of the CSDADC status byte */
-            context->status |= (uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
-            /* Set CADADC FSM status */
-            context->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
-            context->status |= (uint16_t)CY_CSDADC_STATUS_CALIBPH1;
-            /* Un-mask ADC_RES interrupt (enable interrupt) */
-            Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VREF, context);
-
-            /* Initialize Watchdog Counter with a time interval that is enough for ADC calibration to complete */
-            watchdogAdcCounter = CY_CSDADC_CAL_WATCHDOG_CYCLES_NUM;
-            while (((context->status & CY_CSDADC_STATUS_FSM_MASK) != 0u) &&  (0u != watchdogAdcCounter))
+            if (0u != (crc & CY_CSDADC_CRC_MSB_MASK))
             {
-                /* Wait until scan complete and decrement Watchdog Counter to prevent unending loop */
-                watchdogAdcCounter--;
+                crc = ((crc << 1u) ^ CY_CSDADC_CRC_POLYNOMIAL) & CY_CSDADC_CRC_SEED;
             }
-            if (0u == watchdogAdcCounter)
+            else
             {
-                result = CY_CSDADC_CALIBRATION_FAIL;
+                crc = (crc << 1u) & CY_CSDADC_CRC_SEED;
             }
         }
     }
-    return (result);
+
+    return ((uint16_t)crc);
 }
 
 
+#if (0u != CY_CSDADC_INSTRUMENTATION_EN)
 /*******************************************************************************
-* Function Name: Cy_CSDADC_GetNextCh
+* Function Name: Cy_CSDADC_UpdatePhaseStat
 ****************************************************************************//**
 *
-* Get the next channel enabled in the channel mask starting from the current.
+* Adds the phase duration to the phase statistics.
 *
-* The function checks whether the current channel is enabled in the chMask.
-* If the current channel is enabled in chMask, the function returns
-* the current number. If not, the function seeks the next enabled channel.
-* If the current channel and all the next are disabled in chMask, the function
-* returns the channel's number.
+* \param phase
+* The phase, refer to \ref cy_en_csdadc_phase_t. The phases out of range
+* and the phases measured without the timestamp function are ignored.
 *
-* \param currChId
-* The ID of the channel to start the enabled checking.
+* \param duration
+* The phase duration in the timestamp units.
 *
 * \param context
 * The pointer to the CSDADC middleware context structure.
 *
+*******************************************************************************/
+static void Cy_CSDADC_UpdatePhaseStat(
+                uint32_t phase,
+                uint32_t duration,
+                cy_stc_csdadc_context_t * context)
+{
+    cy_stc_csdadc_phase_stat_t * ptrStat;
+
+    if ((NULL != context->ptrTimestamp) && (CY_CSDADC_PHASE_NUM > phase))
+    {
+        ptrStat = &context->phaseStat[phase];
+        ptrStat->sum += duration;
+        ptrStat->count++;
+        if (ptrStat->min > duration)
+        {
+            ptrStat->min = duration;
+        }
+        if (ptrStat->max < duration)
+        {
+            ptrStat->max = duration;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_CSDADC_GetConversionPhase
+****************************************************************************//**
+*
+* Returns the statistics phase of the conversion started in the specified
+* FSM state.
+*
+* \param fsmStatus
+* The FSM status bits of the CSDADC status.
+*
 * \return
-* The function returns the next enabled channel number starting from
-* the current one.
+* The phase or CY_CSDADC_PHASE_NUM if no conversion is started in the state.
 *
 *******************************************************************************/
-static uint8_t Cy_CSDADC_GetNextCh(
-                uint8_t currChId,
-                const cy_stc_csdadc_context_t * context)
+static uint32_t Cy_CSDADC_GetConversionPhase(
+                uint32_t fsmStatus)
 {
-    uint8_t chId = currChId;
-    uint32_t chPos = 1uL << currChId;
-
-    /* Choose the first set channel to convert */
-    while ((chId < context->cfgCopy.numChannels) && (0u == (chPos & context->chMask)))
+    static const uint8_t fsmPhase[] =
     {
-        chPos <<= 1u;
-        chId++;
+        (uint8_t)CY_CSDADC_PHASE_NUM,           /* CY_CSDADC_STATUS_FSM_IDLE */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH1,      /* CY_CSDADC_STATUS_CALIBPH1 */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH2,      /* CY_CSDADC_STATUS_CALIBPH2 */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH3,      /* CY_CSDADC_STATUS_CALIBPH3 */
+        (uint8_t)CY_CSDADC_PHASE_CONVERSION,    /* CY_CSDADC_STATUS_CONVERTING */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH1,      /* CY_CSDADC_STATUS_VDDAPH1 */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH2,      /* CY_CSDADC_STATUS_VDDAPH2 */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH3,      /* CY_CSDADC_STATUS_VDDAPH3 */
+        (uint8_t)CY_CSDADC_PHASE_CONVERSION,    /* CY_CSDADC_STATUS_AMUXB */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH1,      /* CY_CSDADC_STATUS_BGCALPH1 */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH2,      /* CY_CSDADC_STATUS_BGCALPH2 */
+        (uint8_t)CY_CSDADC_PHASE_CALIBPH3,      /* CY_CSDADC_STATUS_BGCALPH3 */
+    };
+    uint32_t phase = CY_CSDADC_PHASE_NUM;
+    uint32_t index = fsmStatus / CY_CSDADC_STATUS_FSM_STEP;
+
+    if ((sizeof(fsmPhase) / sizeof(fsmPhase[0u])) > index)
+    {
+        phase = fsmPhase[index];
     }
 
-    return (chId);
+    return (phase);
 }
+#endif /* (0u != CY_CSDADC_INSTRUMENTATION_EN) */
 
 
 /*******************************************************************************
@@ -2273,15 +5968,10 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
 {
     cy_stc_csdadc_context_t * csdadcCxt = (cy_stc_csdadc_context_t *) CSDADC_Context;
 
-    uint32_t interruptState;
-
     uint32_t tmpResult;
     uint32_t polarity;
 
     uint16_t timeVssa2Vref = csdadcCxt->tVssa2Vref;
-    uint16_t timeFull = csdadcCxt->tFull;
-    uint16_t voltageMaxMv = csdadcCxt->vMaxMv;
-    uint16_t timeVdda2Vref = csdadcCxt->tVdda2Vref;
     uint16_t timeRecover = csdadcCxt->tRecover;
 
     CSD_Type * ptrCsdBaseAdd = csdadcCxt->cfgCopy.base;
@@ -2289,6 +5979,13 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
     uint8_t adcFsmStatus;
     uint8_t tmpChId;
 
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        uint32_t isrStart = Cy_CSDADC_GetTimestamp(csdadcCxt);
+        /* The conversion ends with the interrupt */
+        Cy_CSDADC_UpdatePhaseStat(Cy_CSDADC_GetConversionPhase((uint32_t)csdadcCxt->status & CY_CSDADC_STATUS_FSM_MASK),
+                                  isrStart - csdadcCxt->phaseStart, csdadcCxt);
+    #endif
+
     (void)base;
 
     /* Mask all CSD HW block interrupts (disable all interrupts) */
@@ -2319,119 +6016,133 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
                 /*
                 * After converting, will calculate an ADC result in mV depending on
                 * sourcing or sinking mode. Checks for saturation in all modes.
+                * In the oversampling mode, the conversion of the active channel
+                * is repeated and the result is calculated from the accumulated time.
                 */
-                /* HSCMP polarity is 0:sink, 1:source */
-                if(0u != polarity) /* Sourcing */
+                if (NULL != csdadcCxt->raw.ptrBuf)
                 {
-                    /* Saturate result at timeVssa2Vref */
-                    tmpResult = (tmpResult > (uint32_t)timeVssa2Vref) ? (uint32_t)timeVssa2Vref : tmpResult;
-                    /* Scale result to Resolution range with rounding*/
-                    tmpResult = ((((uint32_t)timeVssa2Vref - tmpResult) * csdadcCxt->codeMax) +
-                                                                     ((uint32_t)timeFull >> 1u)) / (uint32_t)timeFull;
+                    /* Store the raw result to be scaled by Cy_CSDADC_ProcessResults() */
+                    Cy_CSDADC_RawPush((uint32_t)tmpChId, tmpResult | polarity, csdadcCxt);
                 }
-                else /* Sinking */
+                else
                 {
-                    if (CY_CSDADC_RANGE_VDDA == csdadcCxt->cfgCopy.range)
-                    {
-                        /* Scale result with sink/source mismatch with rounding */
-                        tmpResult = (((uint32_t)((uint32_t)timeRecover << 1u) * tmpResult) +
-                                                            ((uint32_t)timeVssa2Vref >> 1u)) / (uint32_t)timeVssa2Vref;
-                        /* Saturate result at t_Vdda2Vref*/
-                        tmpResult = (tmpResult > (uint32_t)timeVdda2Vref) ? (uint32_t)timeVdda2Vref : tmpResult;
-                        /* Scale result to Resolution range with rounding */
-                        tmpResult = ((((uint32_t)timeVssa2Vref + tmpResult) * csdadcCxt->codeMax)  +
-                                     ((uint32_t)timeFull >> 1u)) / (uint32_t)timeFull;
-                    }
-                    else
-                    {
-                        /* In vref mode, we are not supposed to be sinking. Saturate */
-                        tmpResult = ((uint32_t)timeVssa2Vref * csdadcCxt->codeMax) / (uint32_t)timeFull;
-                    }
+                    csdadcCxt->osSum += Cy_CSDADC_GetTime(tmpResult, polarity,
+                                                Cy_CSDADC_GetChRange((uint32_t)tmpChId, csdadcCxt), csdadcCxt);
                 }
+                csdadcCxt->osCnt++;
 
-                /* Store the ADC result code */
-                csdadcCxt->adcResult[tmpChId].code = (uint16_t)(tmpResult);
-                /* Scales the result to mV with rounding and stores it */
-                tmpResult = (((uint32_t)voltageMaxMv * tmpResult) + ((uint32_t)csdadcCxt->codeMax >> 1u)) /
-                                                                                    (uint32_t)csdadcCxt->codeMax;
-                csdadcCxt->adcResult[tmpChId].mVolts = (uint16_t)(tmpResult);
-
-                /* Checks for the current channel stop */
-                if ((uint16_t)CY_CSDADC_CURRENT_CHAN_STOP ==
-                        ((csdadcCxt->status & CY_CSDADC_STOP_BITS_MASK) >> CY_CSDADC_STOP_BITS_POS))
+                if ((uint32_t)csdadcCxt->osCnt < CY_CSDADC_OVERSAMPLING_NUM(csdadcCxt->cfgCopy.oversampling))
                 {
-                    /* Clears all status bits except the initialization bit */
-                    csdadcCxt->status &= (uint16_t)CY_CSDADC_INIT_MASK;
+                    /* Repeat the conversion of the connected channel */
+                    Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, csdadcCxt);
                 }
                 else
                 {
-                    /* Gets next channel ID and checks whether it is chosen in chMask */
-                    tmpChId++;
-                    tmpChId = Cy_CSDADC_GetNextCh(tmpChId, csdadcCxt);
-                    /* Checks whether it is the last channel */
-                    if ((tmpChId >= csdadcCxt->cfgCopy.numChannels))
+                    csdadcCxt->osCnt = 0u;
+                    if (NULL == csdadcCxt->raw.ptrBuf)
+                    {
+                        Cy_CSDADC_StoreResult((uint32_t)tmpChId, csdadcCxt);
+                    }
+
+                    /* Checks for the current channel stop */
+                    if ((uint16_t)CY_CSDADC_CURRENT_CHAN_STOP ==
+                            ((csdadcCxt->status & CY_CSDADC_STOP_BITS_MASK) >> CY_CSDADC_STOP_BITS_POS))
+                    {
+                        /* Clears all status bits except the initialization bit */
+                        csdadcCxt->status &= (uint16_t)CY_CSDADC_INIT_MASK;
+                    }
+                    else
                     {
-                        /* Check for single shot mode or enabled channel stop */
-                        if (((uint16_t)CY_CSDADC_SINGLE_SHOT ==
-                                ((csdadcCxt->status & CY_CSDADC_CONV_MODE_MASK) >> CY_CSDADC_CONV_MODE_BIT_POS)) ||
-                            ((uint16_t)CY_CSDADC_ENABLED_CHAN_STOP ==
-                                    ((csdadcCxt->status & CY_CSDADC_STOP_BITS_MASK) >> CY_CSDADC_STOP_BITS_POS)))
+                        /* Gets next channel ID scheduled in the current cycle */
+                        tmpChId++;
+                        tmpChId = Cy_CSDADC_GetNextCh(tmpChId, csdadcCxt);
+                        /* Checks whether it is the last channel */
+                        if ((tmpChId >= csdadcCxt->cfgCopy.numChannels))
                         {
-                            /* Clears all status bits except the initialization bit */
-                            csdadcCxt->status &= CY_CSDADC_INIT_MASK;
+                            /* Publish the complete frame, the frames are not updated in the raw capture mode */
+                            if ((NULL != csdadcCxt->ptrFrame) && (NULL == csdadcCxt->raw.ptrBuf))
+                            {
+                                Cy_CSDADC_FlipFrame(csdadcCxt);
+                            }
+                            /* Check for single shot mode or enabled channel stop */
+                            if (((uint16_t)CY_CSDADC_SINGLE_SHOT ==
+                                    ((csdadcCxt->status & CY_CSDADC_CONV_MODE_MASK) >> CY_CSDADC_CONV_MODE_BIT_POS)) ||
+                                ((uint16_t)CY_CSDADC_ENABLED_CHAN_STOP ==
+                                        ((csdadcCxt->status & CY_CSDADC_STOP_BITS_MASK) >> CY_CSDADC_STOP_BITS_POS)))
+                            {
+                                /* Clears all status bits except the initialization bit */
+                                csdadcCxt->status &= CY_CSDADC_INIT_MASK;
+                            }
+                            else
+                            {
+                                /* Call an EOC callback if defined */
+                                if(NULL != csdadcCxt->ptrEOCCallback)
+                                {
+                                    csdadcCxt->ptrEOCCallback((cy_stc_csdadc_context_t *)csdadcCxt);
+                                }
+                                /* Schedule the next cycle, the cycles without scheduled channels are skipped */
+                                tmpResult = Cy_CSDADC_ScheduleCycle(csdadcCxt) + 1u;
+                                /* For Continuous mode, start from the first scheduled channel again */
+                                tmpChId = Cy_CSDADC_GetNextCh(0u, csdadcCxt);
+                                /* Update the conversion counter */
+                                tmpResult += csdadcCxt->counter & CY_CSDADC_COUNTER_CYCLE_MASK;
+                                /* Does not allow an overflow of the cycle counter */
+                                if (tmpResult >= CY_CSDADC_COUNTER_CYCLE_MASK)
+                                {
+                                    tmpResult -= (uint32_t)CY_CSDADC_COUNTER_CYCLE_MASK;
+                                }
+                                csdadcCxt->counter = (uint32_t)(((uint32_t)tmpChId) << CY_CSDADC_COUNTER_CHAN_POS) | tmpResult;
+                                /* Count down the background calibration interval */
+                                if (1u == csdadcCxt->calibrCnt)
+                                {
+                                    csdadcCxt->calibrCnt = csdadcCxt->cfgCopy.calibrInterval;
+                                    /* Disconnect the input channel and start the background calibration */
+                                    Cy_CSDADC_SwitchAdcChannel((uint32_t)CY_CSDADC_NO_CHANNEL, csdadcCxt);
+                                    csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+                                    csdadcCxt->status |= (uint16_t)CY_CSDADC_STATUS_BGCALPH1;
+                                    Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VREF, csdadcCxt);
+                                }
+                                else
+                                {
+                                    if (0u != csdadcCxt->calibrCnt)
+                                    {
+                                        csdadcCxt->calibrCnt--;
+                                    }
+                                    /* Switch to the desired input channel */
+                                    Cy_CSDADC_SwitchAdcChannel((uint32_t)tmpChId, csdadcCxt);
+                                    /* Start conversion */
+                                    Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, csdadcCxt);
+                                }
+                            }
                         }
                         else
                         {
-                            /* Call an EOC callback if defined */
-                            if(NULL != csdadcCxt->ptrEOCCallback)
-                            {
-                                csdadcCxt->ptrEOCCallback((cy_stc_csdadc_context_t *)csdadcCxt);
-                            }
-                            /* For Continuous mode, start from the first channel again */
-                            tmpChId = Cy_CSDADC_GetNextCh(0u, csdadcCxt);
-                            /* Disconnect the current input channel */
-                            Cy_CSDADC_SetAdcChannel((uint32_t)csdadcCxt->activeCh, CY_CSDADC_CHAN_DISCONNECT, csdadcCxt);
-                            /* Connect desired input channel */
-                            Cy_CSDADC_SetAdcChannel((uint32_t)tmpChId, CY_CSDADC_CHAN_CONNECT, csdadcCxt);
-                            csdadcCxt->activeCh = tmpChId;
+                            /* Switch to the next input channel set in chMask*/
+                            Cy_CSDADC_SwitchAdcChannel((uint32_t)tmpChId, csdadcCxt);
                             /* Update the conversion counter */
                             csdadcCxt->counter &= (uint32_t)~CY_CSDADC_COUNTER_CHAN_MASK;
                             csdadcCxt->counter |= (uint32_t)(((uint32_t)tmpChId) << CY_CSDADC_COUNTER_CHAN_POS);
-                            csdadcCxt->counter++;
-                            /* Does not allow an overflow of the cycle counter */
-                            if ((csdadcCxt->counter & CY_CSDADC_COUNTER_CYCLE_MASK) == CY_CSDADC_COUNTER_CYCLE_MASK)
-                            {
-                                csdadcCxt->counter &= (uint32_t)~CY_CSDADC_COUNTER_CYCLE_MASK;
-                            }
                             /* Start conversion */
                             Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, csdadcCxt);
                         }
                     }
-                    else
-                    {
-                        /* Disconnect the current input channel */
-                        Cy_CSDADC_SetAdcChannel((uint32_t)csdadcCxt->activeCh, CY_CSDADC_CHAN_DISCONNECT, csdadcCxt);
-                        /* Connect the next input channel set in chMask*/
-                        Cy_CSDADC_SetAdcChannel((uint32_t)tmpChId, CY_CSDADC_CHAN_CONNECT, csdadcCxt);
-                        csdadcCxt->activeCh = tmpChId;
-                        /* Update the conversion counter */
-                        csdadcCxt->counter &= (uint32_t)~CY_CSDADC_COUNTER_CHAN_MASK;
-                        csdadcCxt->counter |= (uint32_t)(((uint32_t)tmpChId) << CY_CSDADC_COUNTER_CHAN_POS);
-                        /* Start conversion */
-                        Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, csdadcCxt);
-                    }
                 }
                 break;
 
             case CY_CSDADC_STATUS_CALIBPH1:
                 /*
                 * After the calibration, phase 1 will define a time to charge Cref1 and Cref2 from Vssa to Vref in
-                * clock cycles. In the full-range mode, the next calibration starts in phase 2. In the Vref mode, this checks for a target
-                * and recalibrates IDAC if necessary.
+                * clock cycles. If the IDAC calibration is enabled, this checks the time for a target and repeats
+                * phase 1 with a new IDAC code if necessary. In the full-range mode, the next calibration starts in phase 2.
                 */
                 csdadcCxt->tVssa2Vref = (uint16_t)tmpResult;
 
-                if (CY_CSDADC_RANGE_VDDA == csdadcCxt->cfgCopy.range)
+                if (0u != Cy_CSDADC_CalibrateIdac(tmpResult, csdadcCxt))
+                {
+                    /* Repeat phase 1 with the new IDAC code */
+                    Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VREF, csdadcCxt);
+                }
+                else if (CY_CSDADC_RANGE_VDDA == csdadcCxt->cfgCopy.range)
                 {
                     /* Full range mode */
                     csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
@@ -2441,8 +6152,7 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
                 else
                 {
                     /* Vref range mode */
-                    csdadcCxt->vMaxMv = csdadcCxt->vRefMv;
-                    csdadcCxt->tFull = csdadcCxt->tVssa2Vref;
+                    Cy_CSDADC_SetCalibration(tmpResult, 0u, 0u, csdadcCxt);
                     /* In vref mode not need further calibration */
                     /* Set idle status */
                     csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
@@ -2460,10 +6170,7 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
                 csdadcCxt->tRecover = (uint16_t)tmpResult;
 
                 /* Disconnect amuxbusB, Connect VDDA to csdbusB */
-                interruptState = Cy_SysLib_EnterCriticalSection();
-                ptrCsdBaseAdd->SW_BYP_SEL &= (uint32_t)(~CY_CSDADC_SW_BYP_DEFAULT);
-                Cy_SysLib_ExitCriticalSection(interruptState);
-                ptrCsdBaseAdd->SW_SHIELD_SEL = CY_CSDADC_SW_SHIELD_VDDA2CSDBUSB;
+                Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_CONNECT, csdadcCxt);
 
                 csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
                 csdadcCxt->status |= (uint16_t)CY_CSDADC_STATUS_CALIBPH3;
@@ -2475,28 +6182,73 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
                 /*
                 * After the calibration, phase 3 will define a time to discharge Cref1 and Cref2 from Vdda to Vref by
                 * a sinking. This time must be corrected to an Idac_sourcing/Idac_sinking mismatch defined in the phase 2.
-                * Calculates t_full, checks it for a target and recalibrates IDAC if necessary. Then this calculates Vdda.
+                * Calculates t_full and Vdda.
                 */
                 /* Reconnect amuxbusB, disconnect VDDA */
-                ptrCsdBaseAdd->SW_SHIELD_SEL = CY_CSDADC_SW_SHIELD_DEFAULT;
-                interruptState = Cy_SysLib_EnterCriticalSection();
-                ptrCsdBaseAdd->SW_BYP_SEL |= CY_CSDADC_SW_BYP_DEFAULT;
-                Cy_SysLib_ExitCriticalSection(interruptState);
-
-                timeVdda2Vref = (uint16_t)tmpResult;
-                /* Calibrate timeVdda2Vref with Sink/Source mismatch with rounding */
-                timeVdda2Vref = (uint16_t)(((((uint32_t)timeVdda2Vref << 1u) * timeRecover) + ((uint32_t)timeVssa2Vref >> 1u)) / timeVssa2Vref);
-                /* Store tVdda2Vref in the CSDADC context structure */
-                csdadcCxt->tVdda2Vref = timeVdda2Vref;
-                /* Store tFull in the CSDADC context structure */
-                csdadcCxt->tFull = (csdadcCxt->tVssa2Vref + timeVdda2Vref);
-                /* Store vMaxMv in the CSDADC context structure */
-                csdadcCxt->vMaxMv = csdadcCxt->vRefMv + (((csdadcCxt->vRefMv * timeVdda2Vref) + (timeVssa2Vref >> 1u)) / timeVssa2Vref);
+                Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, csdadcCxt);
+
+                /* Calculate and store tVdda2Vref, tFull, and vMaxMv in the CSDADC context structure */
+                Cy_CSDADC_SetCalibration((uint32_t)timeVssa2Vref, (uint32_t)timeRecover, tmpResult, csdadcCxt);
                 /* Set the idle status */
                 csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
                 csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
                 break;
 
+            case CY_CSDADC_STATUS_VDDAPH1:
+            case CY_CSDADC_STATUS_BGCALPH1:
+                /*
+                * The VDDA measurement and background calibration phases repeat the calibration phases,
+                * but the calibration data is not changed until the last phase completes.
+                */
+                csdadcCxt->measVssa2Vref = (uint16_t)tmpResult;
+                if ((CY_CSDADC_STATUS_BGCALPH1 == adcFsmStatus) && (CY_CSDADC_RANGE_VREF == csdadcCxt->cfgCopy.range))
+                {
+                    /* In vref mode not need further calibration */
+                    Cy_CSDADC_SetCalibration(tmpResult, 0u, 0u, csdadcCxt);
+                    Cy_CSDADC_ResumeConversion(csdadcCxt);
+                }
+                else
+                {
+                    csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+                    csdadcCxt->status |= (uint16_t)((uint32_t)adcFsmStatus + CY_CSDADC_STATUS_FSM_STEP);
+                    Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VREFBY2, csdadcCxt);
+                }
+                break;
+
+            case CY_CSDADC_STATUS_VDDAPH2:
+            case CY_CSDADC_STATUS_BGCALPH2:
+                csdadcCxt->measRecover = (uint16_t)tmpResult;
+                /* Disconnect amuxbusB, Connect VDDA to csdbusB */
+                Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_CONNECT, csdadcCxt);
+                csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_FSM_MASK;
+                csdadcCxt->status |= (uint16_t)((uint32_t)adcFsmStatus + CY_CSDADC_STATUS_FSM_STEP);
+                Cy_CSDADC_StartFSM(CY_CSDADC_MEASMODE_VIN, csdadcCxt);
+                break;
+
+            case CY_CSDADC_STATUS_VDDAPH3:
+                /* Reconnect amuxbusB, disconnect VDDA */
+                Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, csdadcCxt);
+                csdadcCxt->vddaMv = (uint16_t)Cy_CSDADC_CalcVdda((uint32_t)csdadcCxt->measVssa2Vref,
+                                                (uint32_t)csdadcCxt->measRecover, tmpResult, csdadcCxt);
+                /* Clear all status bits except the initialization bit */
+                csdadcCxt->status &= (uint16_t)CY_CSDADC_INIT_MASK;
+                break;
+
+            case CY_CSDADC_STATUS_BGCALPH3:
+                /* Reconnect amuxbusB, disconnect VDDA */
+                Cy_CSDADC_SetVddaSwitch(CY_CSDADC_CHAN_DISCONNECT, csdadcCxt);
+                /* Update the whole calibration data set at once and continue the conversion */
+                Cy_CSDADC_SetCalibration((uint32_t)csdadcCxt->measVssa2Vref, (uint32_t)csdadcCxt->measRecover,
+                                                                                            tmpResult, csdadcCxt);
+                Cy_CSDADC_ResumeConversion(csdadcCxt);
+                break;
+
+            case CY_CSDADC_STATUS_AMUXB:
+                csdadcCxt->vBusBMv = (uint16_t)Cy_CSDADC_ResultToMv(tmpResult, polarity, csdadcCxt);
+                /* Clear all status bits except the initialization bit */
+                csdadcCxt->status &= (uint16_t)CY_CSDADC_INIT_MASK;
+                break;
+
             default:
                 /* If interrupt is called without a defined ADC state, do nothing. */
                 break;
@@ -2511,6 +6263,10 @@ void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context)
     {
         csdadcCxt->status &= (uint16_t)~(uint16_t)CY_CSDADC_STATUS_BUSY_MASK;
     }
+
+    #if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+        Cy_CSDADC_UpdatePhaseStat(CY_CSDADC_PHASE_ISR, Cy_CSDADC_GetTimestamp(csdadcCxt) - isrStart, csdadcCxt);
+    #endif
 }
 
 #endif /* (defined(CY_IP_MXCSDV2) || defined(CY_IP_M0S8CSDV2)) */
@@ -336,6 +336,15 @@
 * Refer to \ref group_csdadc_quick_start section for the application layer code
 * required to set up CSDADC and run the measurement.
 *
+* The timing parameters of the configuration structure can be checked at
+* build time with the CY_CSDADC_TIMING_IS_VALID() macro, e.g.:
+*
+*   <tt>_Static_assert(CY_CSDADC_TIMING_IS_VALID(48000000u, 1u, 10u, 5u), "CSDADC timing");</tt>
+*
+* The CY_CSDADC_SNSCLK_DIVIDER(), CY_CSDADC_ACQ_CYCLES(), and
+* CY_CSDADC_AZ_CYCLES() macros return the same sense clock divider and
+* numbers of the sense clock cycles as calculated by Cy_CSDADC_Init().
+*
 ********************************************************************************
 * \section group_csdadc_use_cases Use Cases
 ********************************************************************************
@@ -410,6 +419,63 @@
 * calibration at the start of CSDADC operation. Periodical re-calibrations
 * are required to keep the measurement results accurate.
 *
+* In Continuous mode, the re-calibration can be performed in the background
+* by setting the calibrInterval field of the \ref cy_stc_csdadc_config_t
+* structure to a non-zero number of enabled channel cycles. Every
+* calibrInterval cycles, the CSDADC interrupt handler disconnects the input
+* channel, runs the calibration phases, updates the calibration data at once
+* after the last phase, and continues the conversion from the first enabled
+* channel. The conversion is not stopped and Cy_CSDADC_IsEndConversion()
+* keeps returning CY_CSDADC_HW_BUSY during the background calibration.
+*
+* To shorten the start-up, the calibration data can be exported by
+* the Cy_CSDADC_ExportCalibration() function into
+* the \ref cy_stc_csdadc_calibr_data_t structure and stored in non-volatile
+* memory. After the next reset, Cy_CSDADC_EnableWarm() is called instead of
+* Cy_CSDADC_Enable(). It imports the stored data and skips the blocking
+* calibration, and the first Continuous mode cycle is followed by
+* the background calibration that refreshes the data. The stored data is
+* rejected if its version or CRC does not match or it was obtained with
+* another Peri Clock, Vref, Vdda, range, resolution, operation clock
+* divider, or with chRangeVref set to zero versus non-zero.
+*
+********************************************************************************
+* \subsection group_csdadc_mixed_ranges Mixed input ranges
+********************************************************************************
+*
+* To convert small signals and rail-level signals in the same scan, set
+* the range field of the \ref cy_stc_csdadc_config_t structure to
+* CY_CSDADC_RANGE_VDDA and set the bits of the small-signal channels in
+* the chRangeVref field. The channels set in chRangeVref are converted in
+* the GND to VREF range and other channels in the GND to VDDA range without
+* a reconfiguration. The calibration of the VDDA range measures the time of
+* the GND to VREF range as its first phase, so one calibration serves both
+* ranges and the interrupt handler selects the scaling of each channel.
+*
+* If chRangeVref is not zero, the IDAC is sized for the GND to VREF range
+* so the channels in this range keep the full resolution. The channels in
+* the GND to VDDA range keep the full resolution as well, but their
+* conversion takes up to VDDA/VREF times longer when VDDA exceeds twice
+* VREF. The code and mV result of a channel, its limits and statistics use
+* the range of the channel. Changing chRangeVref from zero to non-zero or
+* back by Cy_CSDADC_WriteConfig() repeats the calibration.
+*
+********************************************************************************
+* \subsection group_csdadc_interrupt_load Interrupt load
+********************************************************************************
+*
+* Every channel conversion ends with the CSDADC interrupt that reads
+* the conversion result, connects the next input channel, and starts
+* the next conversion. The channel connection modifies the HSIOM port
+* registers that are shared with other pins and the conversion start
+* depends on the result of the previous channel, so the channel sequencing
+* is not offloaded to DMA. To reduce the interrupt load at high
+* conversion rates:
+* * Convert the slow signals less often by Cy_CSDADC_SetChannelRate().
+* * Read the results in batches by the streaming mode or the result frames,
+*   refer to Cy_CSDADC_StreamEnable() and Cy_CSDADC_FrameEnable(), instead
+*   of handling the EOC callback.
+*
 ********************************************************************************
 * \subsection group_csdadc_time_multiplexing Time-multiplexing operation of CSDADC and CAPSENSE&trade;
 ********************************************************************************
@@ -819,6 +885,15 @@
 * * Use the Cy_CSDADC_UnRegisterCallback() API to un-register the callback
 *   function that was previously assigned.
 *
+* A limit callback is called from the CSDADC interrupt handler when
+* the conversion result of a channel crosses its low or high threshold.
+* The limit callback uses the following function prototype:
+*
+*   <tt>void LimitCallbackFunction(uint32_t chId, cy_en_csdadc_limit_state_t state, (void *) ptrCxt);</tt>
+*
+* The limit callback and the thresholds are assigned by the
+* Cy_CSDADC_LimitEnable() function.
+*
 * \}
 */
 
@@ -854,6 +929,78 @@ extern "C" {
 #define CY_CSDADC_MAX_CHAN_NUM                  (32u)
 /** The parameter for no active CSDADC channel indication */
 #define CY_CSDADC_NO_CHANNEL                    (0xFFu)
+/** The max channel conversion rate divider */
+#define CY_CSDADC_RATE_DIV_MAX                  (255u)
+/** The version of the calibration data structure */
+#define CY_CSDADC_CALIBR_DATA_VERSION           (2u)
+/** The min sense clock divider */
+#define CY_CSDADC_MIN_SNSCLK_DIVIDER            (4u)
+/** The max sense clock divider */
+#define CY_CSDADC_MAX_SNSCLK_DIVIDER            (0xFFFu)
+/** The max number of the sense clock cycles of the acquisition or auto-zero time */
+#define CY_CSDADC_MAX_SNSCLK_CYCLES             (0xFFu)
+/** The max acquisition time in us */
+#define CY_CSDADC_MAX_ACQ_TIME                  (0xFFu)
+/** The min number of the result frames */
+#define CY_CSDADC_FRAME_NUM_MIN                 (2u)
+/** The max number of the result frames */
+#define CY_CSDADC_FRAME_NUM_MAX                 (3u)
+
+/* Timing calculation macros */
+/** The number of the CSDADC operation clock cycles in the specified time in us */
+#define CY_CSDADC_TIME_TO_CLK_CYCLES(timeUs, periClk, operClkDivider) \
+            ((((uint32_t)(timeUs)) * (((uint32_t)(periClk)) / 1000000u)) / ((uint32_t)(operClkDivider)))
+
+/** The number of the CSDADC operation clock cycles in the longer of the acquisition and auto-zero times */
+#define CY_CSDADC_MAX_TIME_CLK_CYCLES(periClk, operClkDivider, acqTime, azTime) \
+            CY_CSDADC_TIME_TO_CLK_CYCLES((((uint32_t)(acqTime)) > ((uint32_t)(azTime))) ? (acqTime) : (azTime), \
+                                         (periClk), (operClkDivider))
+
+/**
+* The smallest sense clock divider that fits the acquisition and auto-zero
+* times into CY_CSDADC_MAX_SNSCLK_CYCLES sense clock cycles. The parameters
+* are the same as the fields of \ref cy_stc_csdadc_config_t.
+*/
+#define CY_CSDADC_SNSCLK_DIVIDER(periClk, operClkDivider, acqTime, azTime) \
+            ((CY_CSDADC_MIN_SNSCLK_DIVIDER > CY_CSDADC_SNSCLK_DIV_MIN_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))) ? \
+                CY_CSDADC_MIN_SNSCLK_DIVIDER : \
+            ((CY_CSDADC_MAX_SNSCLK_DIVIDER < CY_CSDADC_SNSCLK_DIV_MIN_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))) ? \
+                CY_CSDADC_MAX_SNSCLK_DIVIDER : \
+                CY_CSDADC_SNSCLK_DIV_MIN_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))))
+
+/** The number of the sense clock cycles of the acquisition time */
+#define CY_CSDADC_ACQ_CYCLES(periClk, operClkDivider, acqTime, azTime) \
+            (CY_CSDADC_TIME_TO_CLK_CYCLES((acqTime), (periClk), (operClkDivider)) / \
+                    CY_CSDADC_SNSCLK_DIVIDER((periClk), (operClkDivider), (acqTime), (azTime)))
+
+/** The number of the sense clock cycles of the auto-zero time */
+#define CY_CSDADC_AZ_CYCLES(periClk, operClkDivider, acqTime, azTime) \
+            (CY_CSDADC_TIME_TO_CLK_CYCLES((azTime), (periClk), (operClkDivider)) / \
+                    CY_CSDADC_SNSCLK_DIVIDER((periClk), (operClkDivider), (acqTime), (azTime)))
+
+/**
+* Checks whether the timing parameters give a valid CSDADC operation:
+* the Peri Clock is at least 1 MHz, the operation clock divider is not zero,
+* and both the acquisition and auto-zero times are from 1 to
+* CY_CSDADC_MAX_SNSCLK_CYCLES sense clock cycles. A zero operClkDivider
+* is replaced by 1 in the cycle calculation, so the macro stays a constant
+* expression and returns false for it.
+*/
+#define CY_CSDADC_TIMING_IS_VALID(periClk, operClkDivider, acqTime, azTime) \
+            ((0u != ((uint32_t)(operClkDivider))) && (1000000u <= ((uint32_t)(periClk))) && \
+             CY_CSDADC_CYCLES_ARE_VALID((periClk), ((0u != ((uint32_t)(operClkDivider))) ? (operClkDivider) : 1u), \
+                                        (acqTime), (azTime)))
+
+/** \cond SECTION_CAPSENSE_INTERNAL */
+#define CY_CSDADC_SNSCLK_DIV_MIN_CYCLES(periClk, operClkDivider, acqTime, azTime) \
+            ((CY_CSDADC_MAX_TIME_CLK_CYCLES((periClk), (operClkDivider), (acqTime), (azTime)) / \
+                    CY_CSDADC_MAX_SNSCLK_CYCLES) + 1u)
+#define CY_CSDADC_CYCLES_ARE_VALID(periClk, operClkDivider, acqTime, azTime) \
+            ((1u <= CY_CSDADC_ACQ_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))) && \
+             (CY_CSDADC_MAX_SNSCLK_CYCLES >= CY_CSDADC_ACQ_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))) && \
+             (1u <= CY_CSDADC_AZ_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))) && \
+             (CY_CSDADC_MAX_SNSCLK_CYCLES >= CY_CSDADC_AZ_CYCLES((periClk), (operClkDivider), (acqTime), (azTime))))
+/** \endcond */
 
 /* Conversion counter defines */
 /** The channel counter mask for the CSDADC operation counter */
@@ -867,6 +1014,18 @@ extern "C" {
 /** The measurement function return for a fail case */
 #define CY_CSDADC_MEASUREMENT_FAILED            (0xFFFFFFFFuL)
 
+/**
+* Enables the phase duration statistics, refer to Cy_CSDADC_GetPhaseStat().
+* The statistics require a timestamp function registered by
+* Cy_CSDADC_RegisterTimestamp(). Define it to 1u in the project build
+* settings to enable the statistics.
+*/
+#ifndef CY_CSDADC_INSTRUMENTATION_EN
+    #define CY_CSDADC_INSTRUMENTATION_EN        (0u)
+#endif
+/** The number of phases in the phase duration statistics */
+#define CY_CSDADC_PHASE_NUM                     (8u)
+
 /** \} group_csdadc_macros */
 
 
@@ -967,6 +1126,38 @@ typedef enum
                                               */
 }cy_en_csdadc_resolution_t;
 
+/**
+* The CSDADC oversampling enumeration type. In the oversampling mode,
+* the CSDADC repeats the conversion of the connected channel the specified
+* number of times and averages the results. Every fourfold oversampling
+* adds one bit to the result, so the channel result code is between 0 and
+* (2^resolution - 1) * 2^oversampling.
+*/
+typedef enum
+{
+    CY_CSDADC_OVERSAMPLING_NONE   = 0u,      /**< No oversampling, one conversion per channel result */
+    CY_CSDADC_OVERSAMPLING_4X     = 1u,      /**< 4 conversions per channel result, 1 additional bit */
+    CY_CSDADC_OVERSAMPLING_16X    = 2u,      /**< 16 conversions per channel result, 2 additional bits */
+    CY_CSDADC_OVERSAMPLING_64X    = 3u,      /**< 64 conversions per channel result, 3 additional bits */
+}cy_en_csdadc_oversampling_t;
+
+/**
+* The CSDADC phase enumeration type. Specifies the step of the CSDADC
+* operation in the phase duration statistics.
+* Refer to the Cy_CSDADC_GetPhaseStat() function.
+*/
+typedef enum
+{
+    CY_CSDADC_PHASE_RESTORE       = 0u,      /**< The Cy_CSDADC_Restore() function */
+    CY_CSDADC_PHASE_CONFIGURE     = 1u,      /**< The CSD HW block configuration by the Cy_CSDADC_Enable() function */
+    CY_CSDADC_PHASE_CALIBPH1      = 2u,      /**< The calibration phase 1 conversion */
+    CY_CSDADC_PHASE_CALIBPH2      = 3u,      /**< The calibration phase 2 conversion */
+    CY_CSDADC_PHASE_CALIBPH3      = 4u,      /**< The calibration phase 3 conversion */
+    CY_CSDADC_PHASE_CONVERSION    = 5u,      /**< The input voltage conversion */
+    CY_CSDADC_PHASE_CH_SWITCH     = 6u,      /**< The input channel switching */
+    CY_CSDADC_PHASE_ISR           = 7u,      /**< The CSDADC interrupt handler */
+}cy_en_csdadc_phase_t;
+
 /**
 * The CSDADC conversion mode enumeration type. Use it to specify
 * Conversion mode of the CSDADC when initiating a new conversion
@@ -1011,6 +1202,18 @@ typedef enum
                                               */
 }cy_en_csdadc_stop_mode_t;
 
+/**
+* The CSDADC limit state enumeration type. Specifies the position of
+* the channel conversion result relative to the channel thresholds.
+* Refer to the Cy_CSDADC_LimitEnable() function.
+*/
+typedef enum
+{
+    CY_CSDADC_LIMIT_INSIDE        = 0u,      /**< The result is inside the thresholds window */
+    CY_CSDADC_LIMIT_BELOW         = 1u,      /**< The result is below the low threshold */
+    CY_CSDADC_LIMIT_ABOVE         = 2u,      /**< The result is above the high threshold */
+}cy_en_csdadc_limit_state_t;
+
 /** \} group_csdadc_enums */
 
 
@@ -1044,7 +1247,7 @@ typedef struct
     uint32_t periClk;                       /**< Peri Clock in Hz */
     int16_t vref;                           /**< Voltage Reference in mV */
     uint16_t vdda;                          /**< Analog Power Voltage in mV */
-    uint16_t calibrInterval;                /**< Interval for auto-calibration. In this version not supported */
+    uint16_t calibrInterval;                /**< Interval for background calibration in the enabled channel cycles of the continuous mode. 0 - disabled */
     cy_en_csdadc_range_t range;             /**< Mode of ADC operation */
     cy_en_csdadc_resolution_t resolution;   /**< Resolution */
     cy_en_divider_types_t periDivTyp;       /**< Peri Clock divider type */
@@ -1054,8 +1257,14 @@ typedef struct
     uint8_t azTime;                         /**< CSDADC auto-zero time in us */
     uint8_t acqTime;                        /**< CSDADC acquisition time in us */
     uint8_t csdInitTime;                    /**< CSD HW Block Initialization time in us */
-    uint8_t idacCalibrationEn;              /**< Enables run-time IDAC calibration. In this version not supported */
+    uint8_t idacCalibrationEn;              /**< Enables the IDAC calibration. Refer to Cy_CSDADC_Calibrate() */
     uint8_t periDivInd;                     /**< Peri Clock divider index */
+    cy_en_csdadc_oversampling_t oversampling;
+                                            /**< Number of conversions averaged per channel result */
+    uint8_t calibrTolerance;                /**< Max drift of the calibration times in 0.1% units accepted by Cy_CSDADC_Restore()
+                                             * without the recalibration. 0 - the drift is not checked */
+    uint32_t chRangeVref;                   /**< Mask of the channels converted in the GND to VREF range when the range is
+                                             * CY_CSDADC_RANGE_VDDA. Refer to \ref group_csdadc_mixed_ranges */
 } cy_stc_csdadc_config_t;
 
 /** CSDADC result structure */
@@ -1064,12 +1273,198 @@ typedef struct {
     uint16_t mVolts;                        /**< Channel conversion result as input voltage in mV */
 } cy_stc_csdadc_result_t;
 
+/**
+* CSDADC extended result structure. The item of the extended result array
+* that is specified by the Cy_CSDADC_ResultExtEnable() function.
+*/
+typedef struct {
+    uint32_t seq;                           /**< Number of the channel results since the array is enabled. 0 - no result yet */
+    uint32_t timestamp;                     /**< Timestamp of the result. Refer to Cy_CSDADC_RegisterTimestamp() */
+    uint16_t code;                          /**< Channel conversion result as ADC code */
+    uint16_t mVolts;                        /**< Channel conversion result as input voltage in mV */
+} cy_stc_csdadc_result_ext_t;
+
+/**
+* CSDADC stream sample structure. The item of the stream buffer that is
+* filled by the CSDADC middleware when the streaming mode is enabled by
+* the Cy_CSDADC_StreamEnable() function.
+*/
+typedef struct {
+    uint32_t cycle;                         /**< The enabled channels cycle number of the conversion. Refer to Cy_CSDADC_GetConversionStatus() */
+    uint16_t code;                          /**< Channel conversion result as ADC code */
+    uint8_t chId;                           /**< ID of the converted channel */
+} cy_stc_csdadc_sample_t;
+
+/**
+* CSDADC stream structure. Holds the single-producer/single-consumer ring
+* buffer state: the CSDADC interrupt handler is the only producer and
+* the Cy_CSDADC_StreamRead() function caller is the only consumer.
+*/
+typedef struct {
+    cy_stc_csdadc_sample_t * ptrBuf;        /**< Pointer to the stream buffer. NULL - the streaming mode is disabled */
+    uint32_t sizeMask;                      /**< Stream buffer size minus 1 */
+    volatile uint32_t head;                 /**< Number of samples written by the interrupt handler */
+    volatile uint32_t tail;                 /**< Number of samples read by Cy_CSDADC_StreamRead() */
+    volatile uint32_t overrunCnt;           /**< Number of samples lost because the stream buffer was full */
+} cy_stc_csdadc_stream_t;
+
+/**
+* CSDADC raw sample structure. The item of the raw capture buffer that is
+* filled by the CSDADC middleware when the raw capture mode is enabled by
+* the Cy_CSDADC_RawCaptureEnable() function.
+*/
+typedef struct {
+    uint32_t adcRes;                        /**< Conversion result value (bits 0..15) and HSCMP polarity (bit 16) of the ADC_RES register */
+    uint8_t chId;                           /**< ID of the converted channel */
+} cy_stc_csdadc_raw_sample_t;
+
+/**
+* CSDADC raw capture structure. Holds the raw capture ring buffer state:
+* the CSDADC interrupt handler is the only producer and
+* the Cy_CSDADC_ProcessResults() function caller is the only consumer.
+*/
+typedef struct {
+    cy_stc_csdadc_raw_sample_t * ptrBuf;    /**< Pointer to the raw capture buffer. NULL - the raw capture mode is disabled */
+    uint32_t sizeMask;                      /**< Raw capture buffer size minus 1 */
+    volatile uint32_t head;                 /**< Number of samples written by the interrupt handler */
+    volatile uint32_t tail;                 /**< Number of samples processed by Cy_CSDADC_ProcessResults() */
+    volatile uint32_t overrunCnt;           /**< Number of samples lost because the raw capture buffer was full */
+} cy_stc_csdadc_raw_capture_t;
+
+/**
+* CSDADC divisor structure. Holds the fixed-point reciprocal of a calibration
+* value so the conversion results are scaled without a run-time division.
+* The structure is updated by the middleware on every calibration.
+*/
+typedef struct {
+    uint32_t mult;                          /**< Reciprocal multiplier. 0 - the divisor is a power of two */
+    uint8_t shift;                          /**< Post-shift of the reciprocal product */
+} cy_stc_csdadc_divisor_t;
+
+/**
+* CSDADC calibration data structure. Holds the calibration data exported by
+* the Cy_CSDADC_ExportCalibration() function to be stored by the application
+* in non-volatile memory and imported after reset by
+* the Cy_CSDADC_ImportCalibration() or Cy_CSDADC_EnableWarm() functions.
+* The structure is protected by the version and the CRC and is bound to
+* the configuration parameters it was calibrated with.
+*/
+typedef struct {
+    uint32_t periClk;                       /**< Peri Clock of the calibrated configuration */
+    uint16_t version;                       /**< Structure version, CY_CSDADC_CALIBR_DATA_VERSION */
+    uint16_t tVssa2Vref;                    /**< Calibration data: the time to charge Cref from Vssa to Vref */
+    uint16_t tRecover;                      /**< Calibration data: the time to recharge Cref to Vref */
+    uint16_t tVdda2Vref;                    /**< Calibration data: the time to discharge Cref from Vdda to Vref */
+    uint16_t tVdda2VrefRaw;                 /**< Calibration data: the phase 3 time not corrected with the Sink/Source mismatch */
+    uint16_t tFull;                         /**< Calibration data: the time of the full range */
+    uint16_t vMaxMv;                        /**< Calibration data: the max measured voltage in mV */
+    uint16_t vRefMv;                        /**< Trimmed Vref of the calibrated configuration in mV */
+    uint16_t vdda;                          /**< Vdda of the calibrated configuration in mV */
+    uint8_t idac;                           /**< IDAC code */
+    uint8_t vRefGain;                       /**< Vref gain of the calibrated configuration */
+    uint8_t operClkDivider;                 /**< Operation clock divider of the calibrated configuration */
+    uint8_t range;                          /**< Range of the calibrated configuration */
+    uint8_t resolution;                     /**< Resolution of the calibrated configuration */
+    uint8_t rangeVref;                      /**< 1 - the IDAC is sized for the channels in the Vref range, refer to
+                                             *   the chRangeVref field of \ref cy_stc_csdadc_config_t */
+    uint8_t reserved[2];                    /**< Reserved, set to 0 */
+    uint16_t crc;                           /**< CRC-16-CCITT of the preceding fields */
+} cy_stc_csdadc_calibr_data_t;
+
+/**
+* CSDADC channel limit structure. The item of the limit array that is
+* specified by the Cy_CSDADC_LimitEnable() function. The thresholds are
+* in ADC codes, the same as the code field of \ref cy_stc_csdadc_result_t.
+* The result leaves the below or above state only when it returns into
+* the window by more than the hysteresis.
+*/
+typedef struct {
+    uint16_t low;                           /**< Low threshold in ADC codes */
+    uint16_t high;                          /**< High threshold in ADC codes */
+    uint16_t hysteresis;                    /**< Hysteresis in ADC codes */
+    cy_en_csdadc_limit_state_t state;       /**< Current limit state. Updated by the middleware */
+} cy_stc_csdadc_limit_t;
+
+/**
+* CSDADC result frame structure. The item of the frame array that is
+* specified by the Cy_CSDADC_FrameEnable() function. A frame holds
+* the results of one enabled channels cycle.
+*/
+typedef struct {
+    uint32_t cycle;                         /**< The enabled channels cycle number of the frame. Refer to Cy_CSDADC_GetConversionStatus() */
+    uint32_t chMask;                        /**< Mask of channels converted in the cycle. The results of other channels are not valid */
+    cy_stc_csdadc_result_t result[CY_CSDADC_MAX_CHAN_NUM];
+                                            /**< Channel conversion results */
+} cy_stc_csdadc_frame_t;
+
+/**
+* CSDADC channel statistics structure. The item of the statistics array that
+* is specified by the Cy_CSDADC_StatEnable() function. The statistics are
+* accumulated in ADC codes, the same as the code field of
+* \ref cy_stc_csdadc_result_t. The mean is sum / count and the variance is
+* sumSq / count - mean * mean.
+*/
+typedef struct {
+    uint64_t sum;                           /**< Sum of the conversion results */
+    uint64_t sumSq;                         /**< Sum of the squared conversion results */
+    uint32_t count;                         /**< Number of the accumulated conversion results */
+    uint16_t min;                           /**< Min conversion result */
+    uint16_t max;                           /**< Max conversion result */
+} cy_stc_csdadc_ch_stat_t;
+
+/**
+* CSDADC request queue structure. Holds the conversion request that waits for
+* the CSD HW block and the arbitration statistics.
+* Refer to the Cy_CSDADC_QueueConvert() function.
+*/
+typedef struct {
+    uint32_t chMask;                        /**< Channel mask of the pending request */
+    uint32_t grantCnt;                      /**< Number of requests started by Cy_CSDADC_ProcessQueue() */
+    uint32_t deferCnt;                      /**< Number of Cy_CSDADC_ProcessQueue() calls deferred because
+                                             *   the CSD HW block is used by another middleware */
+    uint16_t waitCnt;                       /**< Number of deferrals of the pending request */
+    uint16_t maxWaitCnt;                    /**< Max number of deferrals of a request before it was started */
+    cy_en_csdadc_conversion_mode_t mode;    /**< Conversion mode of the pending request */
+    uint8_t pending;                        /**< 1 - a request is pending */
+    uint8_t acquired;                       /**< 1 - the CSD HW block is captured by Cy_CSDADC_ProcessQueue() */
+} cy_stc_csdadc_queue_t;
+
+/**
+* CSDADC phase statistics structure. Holds the durations of a CSDADC
+* operation phase in the timestamp units. The mean duration is sum / count.
+* Refer to the Cy_CSDADC_GetPhaseStat() function.
+*/
+typedef struct {
+    uint64_t sum;                           /**< Sum of the phase durations */
+    uint32_t min;                           /**< Min phase duration */
+    uint32_t max;                           /**< Max phase duration */
+    uint32_t count;                         /**< Number of the measured phases */
+} cy_stc_csdadc_phase_stat_t;
+
 /**
 * Provides the typedef for the callback function that is intended to be called
 * when the "End Of Conversion" cycle callback event occurs.
 */
 typedef void (*cy_csdadc_callback_t)(void * ptrCxt);
 
+/**
+* Provides the typedef for the timestamp function. The function returns
+* a free-running 32-bit up-counter, e.g. DWT->CYCCNT on the CM4 core.
+* The durations are calculated as the unsigned 32-bit difference of two
+* timestamps, so the counter must wrap from 0xFFFFFFFF to 0 only.
+* The SysTick counter is 24-bit and counts down to its reload value, so it
+* cannot be returned directly. On the CM0+ core, extend it to a 32-bit
+* up-counter in software, e.g. count the SysTick wraps in the SysTick
+* interrupt and return (wraps * (LOAD + 1)) + (LOAD - VAL).
+*/
+typedef uint32_t (*cy_csdadc_timestamp_t)(void);
+
+/**
+* Provides the typedef for the callback function that is intended to be called
+* when the conversion result of a channel changes its limit state.
+*/
+typedef void (*cy_csdadc_limit_callback_t)(uint32_t chId, cy_en_csdadc_limit_state_t state, void * ptrCxt);
+
 /**
 * The CSDADC context structure, which contains the internal driver data
 * for the CSDADC MW. The context structure should be allocated by the user
@@ -1085,6 +1480,7 @@ typedef struct{
     uint32_t counter;                       /**< Counter for CSDADC operations:
                                              * * bit [0:26] - current enabled channels cycle number:
                                              *     * In the continuous mode, sets to 0 with the conversion start and increments with every enabled channel cycle
+                                             *       including the cycles where no channel is scheduled by the channel rate dividers
                                              *     * In the single shot mode, is equal to 0
                                              * * bits [27:31] - current channel number inside the current cycle */
     volatile uint16_t status;               /**< Current CSDADC status:
@@ -1098,6 +1494,13 @@ typedef struct{
                                              *     * 2 - CY_CSDADC_STATUS_CALIBPH2
                                              *     * 3 - CY_CSDADC_STATUS_CALIBPH3
                                              *     * 4 - CY_CSDADC_STATUS_CONVERTING
+                                             *     * 5 - CY_CSDADC_STATUS_VDDAPH1
+                                             *     * 6 - CY_CSDADC_STATUS_VDDAPH2
+                                             *     * 7 - CY_CSDADC_STATUS_VDDAPH3
+                                             *     * 8 - CY_CSDADC_STATUS_AMUXB
+                                             *     * 9 - CY_CSDADC_STATUS_BGCALPH1
+                                             *     * 10 - CY_CSDADC_STATUS_BGCALPH2
+                                             *     * 11 - CY_CSDADC_STATUS_BGCALPH3
                                              * * bit [9] - stop conversion mode
                                              *     * 0 - stop after current channel conversion
                                              *     * 1 - stop after all enabled channels in chMask */
@@ -1118,6 +1521,51 @@ typedef struct{
     uint8_t snsClkDivider;                  /**< Divider of sense clock */
     uint8_t acqCycles;                      /**< Acquisition time in Sns cycles */
     uint8_t azCycles;                       /**< Auto-zero time in in Sns cycles */
+    cy_stc_csdadc_divisor_t divFull;        /**< Reciprocal of tFull */
+    cy_stc_csdadc_divisor_t divVssa2Vref;   /**< Reciprocal of tVssa2Vref */
+    cy_stc_csdadc_divisor_t divCodeMax;     /**< Reciprocal of codeMax */
+    cy_stc_csdadc_stream_t stream;          /**< Streaming mode ring buffer */
+    cy_stc_csdadc_raw_capture_t raw;        /**< Raw capture mode ring buffer */
+    uint32_t osSum;                         /**< Oversampling accumulator of the active channel */
+    uint8_t osCnt;                          /**< Number of accumulated oversampling conversions */
+    uint16_t measVssa2Vref;                 /**< Phase 1 result of the non-blocking Vdda measurement or background calibration */
+    uint16_t measRecover;                   /**< Phase 2 result of the non-blocking Vdda measurement or background calibration */
+    uint16_t calibrCnt;                     /**< Number of enabled channel cycles left to the background calibration */
+    uint16_t tVdda2VrefRaw;                 /**< Calibration data: the phase 3 time not corrected with the Sink/Source mismatch */
+    uint8_t calibrDone;                     /**< 1 - the calibration data is valid. Refer to Cy_CSDADC_WriteConfig() */
+    uint8_t calibrPending;                  /**< 1 - the calibration data is imported and the background calibration is pending.
+                                             *   Refer to Cy_CSDADC_EnableWarm() */
+    uint16_t idacTarget;                    /**< Target phase 1 time of the IDAC calibration */
+    uint8_t idacLow;                        /**< Low bound of the IDAC code search */
+    uint8_t idacHigh;                       /**< High bound of the IDAC code search. 0 - no search in progress */
+    cy_stc_csdadc_queue_t queue;            /**< Request queue of the CSD HW block arbitration */
+    cy_csdadc_timestamp_t ptrTimestamp;     /**< Pointer to a user's timestamp function. Refer to Cy_CSDADC_RegisterTimestamp() */
+#if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+    uint32_t phaseStart;                    /**< Timestamp of the last conversion start */
+    cy_stc_csdadc_phase_stat_t phaseStat[CY_CSDADC_PHASE_NUM];
+                                            /**< Phase duration statistics */
+#endif
+    uint32_t cycleMask;                     /**< Mask of channels scheduled in the current enabled channel cycle */
+    uint32_t rateMask;                      /**< Mask of channels with the rate divider greater than 1 */
+    uint8_t chRateDiv[CY_CSDADC_MAX_CHAN_NUM];
+                                            /**< Conversion rate divider of each channel. Refer to Cy_CSDADC_SetChannelRate() */
+    uint8_t chRateCnt[CY_CSDADC_MAX_CHAN_NUM];
+                                            /**< Number of enabled channel cycles left to the next conversion of each channel */
+    uint8_t chAcqCycles[CY_CSDADC_MAX_CHAN_NUM];
+                                            /**< Acquisition time of each channel in Sns cycles. Refer to Cy_CSDADC_SetChannelAcqTime() */
+    cy_stc_csdadc_limit_t * ptrLimit;       /**< Pointer to the channel limit array. NULL - the limit detection is disabled */
+    cy_csdadc_limit_callback_t ptrLimitCallback;
+                                            /**< Pointer to a user's limit callback function. Refer to \ref group_csdadc_callback section */
+    uint32_t limitMask;                     /**< Mask of channels with the enabled limit detection */
+    cy_stc_csdadc_ch_stat_t * ptrStat;      /**< Pointer to the channel statistics array. NULL - the statistics are disabled */
+    uint32_t statMask;                      /**< Mask of channels with the enabled statistics */
+    cy_stc_csdadc_result_ext_t * ptrResultExt;
+                                            /**< Pointer to the extended result array. NULL - the extended results are disabled */
+    cy_stc_csdadc_frame_t * ptrFrame;       /**< Pointer to the result frame array. NULL - the result frames are disabled */
+    uint8_t frameNum;                       /**< Number of the result frames */
+    uint8_t frameWrite;                     /**< Index of the frame filled by the interrupt handler */
+    volatile uint8_t frameLatest;           /**< Index of the latest complete frame */
+    volatile uint8_t frameRead;             /**< Index of the frame returned by Cy_CSDADC_GetLatestFrame() */
 }cy_stc_csdadc_context_t;
 
 /** \} group_csdadc_data_structures */
@@ -1136,6 +1584,9 @@ cy_en_csdadc_status_t Cy_CSDADC_Init(
                 cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_Enable(
                 cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_EnableWarm(
+                const cy_stc_csdadc_calibr_data_t * calibrData,
+                cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_DeInit(
                 cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_WriteConfig(
@@ -1146,6 +1597,17 @@ cy_en_csdadc_status_t Cy_CSDADC_RegisterCallback(
                 cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_UnRegisterCallback(
                 cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_RegisterTimestamp(
+                cy_csdadc_timestamp_t timestampFunction,
+                cy_stc_csdadc_context_t * context);
+#if (0u != CY_CSDADC_INSTRUMENTATION_EN)
+cy_en_csdadc_status_t Cy_CSDADC_GetPhaseStat(
+                cy_en_csdadc_phase_t phase,
+                cy_stc_csdadc_phase_stat_t * stat,
+                const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_ResetPhaseStat(
+                cy_stc_csdadc_context_t * context);
+#endif
 cy_en_csdadc_status_t Cy_CSDADC_StartConvert(
                 cy_en_csdadc_conversion_mode_t mode,
                 uint32_t chMask,
@@ -1153,12 +1615,24 @@ cy_en_csdadc_status_t Cy_CSDADC_StartConvert(
 cy_en_csdadc_status_t Cy_CSDADC_StopConvert(
                 cy_en_csdadc_stop_mode_t stopMode,
                 cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_QueueConvert(
+                cy_en_csdadc_conversion_mode_t mode,
+                uint32_t chMask,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_ProcessQueue(
+                cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_IsEndConversion(
                 const cy_stc_csdadc_context_t * context);
 uint32_t Cy_CSDADC_GetConversionStatus(
                 const cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_Calibrate(
                 cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_ExportCalibration(
+                cy_stc_csdadc_calibr_data_t * calibrData,
+                const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_ImportCalibration(
+                const cy_stc_csdadc_calibr_data_t * calibrData,
+                cy_stc_csdadc_context_t * context);
 cy_en_csdadc_status_t Cy_CSDADC_Wakeup(
                 const cy_stc_csdadc_context_t * context);
 cy_en_syspm_status_t Cy_CSDADC_DeepSleepCallback(
@@ -1173,8 +1647,79 @@ uint32_t Cy_CSDADC_GetResult(
 uint32_t Cy_CSDADC_GetResultVoltage(
                 uint32_t chId,
                 const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_SetChannelRate(
+                uint32_t chId,
+                uint32_t rateDiv,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_SetChannelAcqTime(
+                uint32_t chId,
+                uint32_t acqTime,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StreamEnable(
+                cy_stc_csdadc_sample_t * buffer,
+                uint32_t size,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StreamDisable(
+                cy_stc_csdadc_context_t * context);
+uint32_t Cy_CSDADC_StreamRead(
+                cy_stc_csdadc_sample_t * samples,
+                uint32_t maxNum,
+                cy_stc_csdadc_context_t * context);
+uint32_t Cy_CSDADC_StreamGetOverrun(
+                const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_RawCaptureEnable(
+                cy_stc_csdadc_raw_sample_t * buffer,
+                uint32_t size,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_RawCaptureDisable(
+                cy_stc_csdadc_context_t * context);
+uint32_t Cy_CSDADC_ProcessResults(
+                cy_stc_csdadc_context_t * context);
+uint32_t Cy_CSDADC_RawCaptureGetOverrun(
+                const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_LimitEnable(
+                cy_stc_csdadc_limit_t * limits,
+                uint32_t limitMask,
+                cy_csdadc_limit_callback_t callbackFunction,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_LimitDisable(
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StatEnable(
+                cy_stc_csdadc_ch_stat_t * stats,
+                uint32_t statMask,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StatDisable(
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StatRead(
+                uint32_t chId,
+                cy_stc_csdadc_ch_stat_t * stat,
+                const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StatReset(
+                uint32_t chMask,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_ResultExtEnable(
+                cy_stc_csdadc_result_ext_t * results,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_ResultExtDisable(
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_GetResultExt(
+                uint32_t chId,
+                cy_stc_csdadc_result_ext_t * result,
+                const cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_FrameEnable(
+                cy_stc_csdadc_frame_t * frames,
+                uint32_t frameNum,
+                cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_FrameDisable(
+                cy_stc_csdadc_context_t * context);
+const cy_stc_csdadc_frame_t * Cy_CSDADC_GetLatestFrame(
+                cy_stc_csdadc_context_t * context);
 uint32_t Cy_CSDADC_MeasureVdda(cy_stc_csdadc_context_t * context);
 uint32_t Cy_CSDADC_MeasureAMuxB(cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StartMeasureVdda(cy_stc_csdadc_context_t * context);
+cy_en_csdadc_status_t Cy_CSDADC_StartMeasureAMuxB(cy_stc_csdadc_context_t * context);
+uint32_t Cy_CSDADC_GetVdda(const cy_stc_csdadc_context_t * context);
+uint32_t Cy_CSDADC_GetAMuxB(const cy_stc_csdadc_context_t * context);
 void Cy_CSDADC_InterruptHandler(const CSD_Type * base, void * CSDADC_Context);
 
 /** \} group_csdadc_functions */